@@ -124,6 +124,12 @@ config_include(
     FILE "memory.h"
 )
 
+config_include(
+    HAVE_LINUX_IO_URING_H
+    "Include header linux/io_uring.h exists."
+    FILE "linux/io_uring.h"
+)
+
 config_func(
     HAVE_CLOCK_GETTIME
     "Function clock_gettime exists."
@@ -488,8 +488,8 @@ connection_runtime_config = [
             enable block cache''',
             type='boolean'),
         Config('blkcache_eviction_aggression', '1800', r'''
-            seconds an unused block remains in the cache before it is evicted''',
-            min='1', max='7200'),
+            this option is no longer supported, retained for backward compatibility''',
+            min='1', max='7200', undoc=True),
         Config('full_target', '95', r'''
             the fraction of the block cache that must be full before eviction will remove
             unused blocks''',
@@ -547,6 +547,11 @@ connection_runtime_config = [
             A database can configure both log_size and wait to set an upper bound for checkpoints;
             setting this value above 0 configures periodic checkpoints''',
             min='0', max='2GB'),
+        Config('threads', '0', r'''
+            the number of threads used to write the trees of a database checkpoint in parallel.
+            The metadata is always updated by the checkpointing thread. If 0, the checkpointing
+            thread writes all of the trees itself''',
+            min='0', max='20'),
         Config('wait', '0', r'''
             seconds to wait between each checkpoint; setting this value above 0 configures
             periodic checkpoints''',
@@ -659,6 +664,11 @@ connection_runtime_config = [
                 If no in-memory ref is found on the root page, attempt to locate a random
                 in-memory page by examining all entries on the root page.''',
                 type='boolean'),
+            Config('parallel_walk', 'false', r'''
+                if true, eviction worker threads that find nothing queued to evict walk trees
+                the eviction server isn't walking, and stage the pages they find for the server
+                to add to the eviction queue''',
+                type='boolean'),
             ]),
     Config('eviction_checkpoint_target', '1', r'''
         perform eviction at the beginning of checkpoints to bring the dirty content in cache
@@ -1004,7 +1014,12 @@ wiredtiger_open_log_configuration = [
         Config('recover', 'on', r'''
             run recovery or fail with an error if recovery needs to run after an unclean
             shutdown''',
-            choices=['error', 'on'])
+            choices=['error', 'on']),
+        Config('recover_threads', '0', r'''
+            the number of threads applying log records during recovery. Operations are handed
+            to the threads by file, so each file's operations are applied in log order. If \c 0,
+            the thread opening the connection applies the log records''',
+            min='0', max='64'),
     ]),
 ]
 
@@ -1268,6 +1283,19 @@ wiredtiger_open_common =\
     Config('hazard_max', '1000', r'''
         maximum number of simultaneous hazard pointers per session handle''',
         min=15, undoc=True),
+    Config('io_uring', '', r'''
+        configure asynchronous reads of data files using the Linux io_uring interface. When
+        enabled, the pre-fetch threads keep multiple reads in flight rather than blocking on each
+        read in turn. Only supported by the built-in POSIX file system on Linux''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            whether io_uring is used for asynchronous reads''',
+            type='boolean'),
+        Config('queue_depth', '64', r'''
+            the number of entries in the io_uring submission queue, which bounds the number of
+            asynchronous reads in flight''',
+            min='1', max='4096'),
+        ]),
     Config('mmap', 'true', r'''
         Use memory mapping when accessing files in a read-only mode''',
         type='boolean'),
@@ -1279,6 +1307,18 @@ wiredtiger_open_common =\
         permit sharing between processes (will automatically start an RPC server for primary
         processes and use RPC for secondary processes). <b>Not yet supported in WiredTiger</b>''',
         type='boolean'),
+    Config('numa', '', r'''
+        configure NUMA awareness. When enabled, cache usage is tracked for each NUMA node by the
+        node on which a page was read, and eviction threads are spread across the nodes and prefer
+        evicting pages from their own node. Only supported on Linux''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            whether the cache and eviction are NUMA aware''',
+            type='boolean'),
+        Config('sysfs_path', '/sys/devices/system/node', r'''
+            the directory the NUMA topology is read from, used for testing''',
+            undoc=True),
+        ]),
     Config('prefetch', '', r'''
         Enable automatic detection of scans by applications, and attempt to pre-fetch future
         content into the cache''',
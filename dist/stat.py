@@ -228,13 +228,22 @@ int
 __wt_stat_''' + name + '''_init(
     WT_SESSION_IMPL *session, ''' + handle + ''' *handle)
 {
+\tsize_t stride;
 \tint i;
+\tuint8_t *p;
 
-\tWT_RET(__wt_calloc(session, (size_t)WT_STAT_''' + capname + '''_COUNTER_SLOTS,
-\t    sizeof(*handle->stat_array), &handle->stat_array));
+\t/*
+\t * Start each structure on its own cache line, the last values of one structure and the first
+\t * values of the next are updated by different threads. Allocate an extra line's worth so the
+\t * first structure can be aligned.
+\t */
+\tstride = (size_t)WT_ALIGN(sizeof(*handle->stat_array), WT_CACHE_LINE_ALIGNMENT);
+\tWT_RET(__wt_calloc(session, (size_t)WT_STAT_''' + capname + '''_COUNTER_SLOTS + 1,
+\t    stride, &handle->stat_array));
+\tp = (uint8_t *)(uintptr_t)WT_ALIGN((uintptr_t)handle->stat_array, WT_CACHE_LINE_ALIGNMENT);
 
 \tfor (i = 0; i < WT_STAT_''' + capname + '''_COUNTER_SLOTS; ++i) {
-\t\thandle->stats[i] = &handle->stat_array[i];
+\t\thandle->stats[i] = (void *)(p + (size_t)i * stride);
 \t\t__wt_stat_''' + name + '''_init_single(handle->stats[i]);
 \t}
 \treturn (0);
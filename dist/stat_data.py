@@ -256,6 +256,12 @@ conn_stats = [
     BlockStat('block_map_read', 'mapped blocks read'),
     BlockStat('block_preload', 'blocks pre-loaded'),
     BlockStat('block_read', 'blocks read'),
+    BlockStat('block_read_async_coalesced', 'blocks read by extending an adjacent asynchronous block read'),
+    BlockStat('block_read_async_discard', 'asynchronous block reads discarded without being used'),
+    BlockStat('block_read_async_hit', 'asynchronous block reads used by a block read'),
+    BlockStat('block_read_io_uring_completed', 'asynchronous reads completed by io_uring'),
+    BlockStat('block_read_io_uring_submitted', 'asynchronous reads submitted to io_uring'),
+    BlockStat('block_read_io_uring_sync', 'asynchronous reads performed synchronously because io_uring was full or unavailable'),
     BlockStat('block_remap_file_resize', 'number of times the file was remapped because it changed size via fallocate or truncate'),
     BlockStat('block_remap_file_write', 'number of times the region was remapped via write'),
     BlockStat('block_write', 'blocks written'),
@@ -343,6 +349,7 @@ conn_stats = [
     EvictStat('eviction_server_skip_trees_eviction_disabled', 'eviction server skips trees that disable eviction'),
     EvictStat('eviction_server_skip_trees_not_useful_before', 'eviction server skips trees that were not useful before'),
     EvictStat('eviction_server_skip_trees_stick_in_cache', 'eviction server skips trees that are configured to stick in cache'),
+    EvictStat('eviction_server_skip_trees_worker_walk', 'eviction server skips trees being walked by an eviction worker thread'),
     EvictStat('eviction_server_skip_unwanted_pages', 'eviction server skips pages that we do not want to evict'),
     EvictStat('eviction_server_skip_unwanted_tree', 'eviction server skips tree that we do not want to evict'),
     EvictStat('eviction_server_slept', 'eviction server slept, because we did not make progress with eviction'),
@@ -370,6 +377,9 @@ conn_stats = [
     EvictStat('eviction_walks_stopped', 'eviction walks gave up because they restarted their walk twice'),
     EvictStat('eviction_worker_evict_attempt', 'evict page attempts by eviction worker threads'),
     EvictStat('eviction_worker_evict_fail', 'evict page failures by eviction worker threads'),
+    EvictStat('eviction_worker_numa_local', 'pages selected for eviction by eviction worker threads from their NUMA node'),
+    EvictStat('eviction_worker_walk', 'eviction walks by eviction worker threads'),
+    EvictStat('eviction_worker_walk_pages_merged', 'pages queued for eviction from eviction worker thread walks'),
     # Note eviction_worker_evict_attempt - eviction_worker_evict_fail = evict page successes by eviction worker threads.
 
     ##########################################
@@ -489,6 +499,7 @@ conn_stats = [
     CursorStat('cursor_reset', 'cursor reset calls'),
     CursorStat('cursor_restart', 'cursor operation restarted'),
     CursorStat('cursor_search', 'cursor search calls'),
+    CursorStat('cursor_search_batch', 'cursor search batch calls'),
     CursorStat('cursor_search_hs', 'cursor search history store calls'),
     CursorStat('cursor_search_near', 'cursor search near calls'),
     CursorStat('cursor_truncate', 'cursor truncate calls'),
@@ -601,6 +612,7 @@ conn_stats = [
     LogStat('log_sync_dir', 'log sync_dir operations'),
     LogStat('log_sync_dir_duration', 'log sync_dir time duration (usecs)', 'no_clear,no_scale'),
     LogStat('log_sync_duration', 'log sync time duration (usecs)', 'no_clear,no_scale'),
+    LogStat('log_sync_group', 'log sync operations extended over records released by other threads'),
     LogStat('log_write_lsn', 'log server thread advances write LSN'),
     LogStat('log_write_lsn_skip', 'log server thread write LSN walk skipped'),
     LogStat('log_writes', 'log write operations'),
@@ -772,6 +784,7 @@ conn_stats = [
     TxnStat('txn_rts_upd_aborted', 'rollback to stable updates aborted'),
     TxnStat('txn_rts_upd_aborted_dryrun', 'rollback to stable updates that would have been aborted in non-dryrun mode'),
     TxnStat('txn_sessions_walked', 'sessions scanned in each walk of concurrent sessions'),
+    TxnStat('txn_snapshot_cache_hit', 'transaction snapshots reused without a walk of concurrent sessions'),
     TxnStat('txn_set_ts', 'set timestamp calls'),
     TxnStat('txn_set_ts_durable', 'set timestamp durable calls'),
     TxnStat('txn_set_ts_durable_upd', 'set timestamp durable updates'),
@@ -930,6 +943,7 @@ dsrc_stats = [
     CursorStat('cursor_reset', 'reset calls'),
     CursorStat('cursor_restart', 'operation restarted'),
     CursorStat('cursor_search', 'search calls'),
+    CursorStat('cursor_search_batch', 'search batch calls'),
     CursorStat('cursor_search_hs', 'search history store calls'),
     CursorStat('cursor_search_near', 'search near calls'),
     CursorStat('cursor_truncate', 'truncate calls'),
@@ -1122,6 +1136,7 @@ conn_dsrc_stats = [
     CursorErrorStat('cursor_reopen_error', 'cursor reopen calls that return an error'),
     CursorErrorStat('cursor_reserve_error', 'cursor reserve calls that return an error'),
     CursorErrorStat('cursor_reset_error', 'cursor reset calls that return an error'),
+    CursorErrorStat('cursor_search_batch_error', 'cursor search batch calls that return an error'),
     CursorErrorStat('cursor_search_error', 'cursor search calls that return an error'),
     CursorErrorStat('cursor_search_near_error', 'cursor search near calls that return an error'),
     CursorErrorStat('cursor_update_error', 'cursor update calls that return an error'),
@@ -280,6 +280,24 @@ cursor_ops(WT_SESSION *session)
 
     cursor_search_near(cursor);
 
+    {
+        /*! [Search for a batch of records] */
+        WT_ITEM keys[2], values[2];
+        int i, results[2];
+
+        /* Keys are packed in the cursor's key format, string keys include the nul terminator. */
+        keys[0].data = "some key";
+        keys[0].size = strlen("some key") + 1;
+        keys[1].data = "another key";
+        keys[1].size = strlen("another key") + 1;
+        error_check(cursor->search_batch(cursor, 2, keys, values, results));
+        for (i = 0; i < 2; ++i)
+            if (results[i] == 0) {
+                /* values[i] is the packed value of keys[i] */
+            }
+        /*! [Search for a batch of records] */
+    }
+
     {
         /*! [Insert a new record and fail if the record exists] */
         /* Insert a new record and fail if the record exists. */
@@ -630,6 +630,9 @@ COMPARE_NOTFOUND_OK(__wt_cursor::_search_near)
 /* Replace get_raw_key_value method with a Python equivalent */
 %ignore __wt_cursor::get_raw_key_value;
 
+/* Replace the search_batch method, which takes C arrays, with a Python equivalent. */
+%ignore __wt_cursor::search_batch;
+
 /* Next, override methods that return integers via arguments. */
 %ignore __wt_cursor::compare(WT_CURSOR *, WT_CURSOR *, int *);
 %ignore __wt_cursor::equals(WT_CURSOR *, WT_CURSOR *, int *);
@@ -702,6 +705,14 @@ OVERRIDE_METHOD(__wt_cursor, WT_CURSOR, search_near, (self))
     $2 = buf;
 }
 
+/* Handle the list of values returned from search_batch. */
+%typemap(in,numinputs=0) (PyObject **valuesp) (PyObject *values) { values = NULL; $1 = &values; }
+%typemap(frearg) (PyObject **valuesp) "";
+%typemap(argout) (PyObject **valuesp) {
+	if (*$1 != NULL)
+		$result = *$1;
+}
+
 /* Handle record number returns from get_recno */
 %typemap(in,numinputs=0) (uint64_t *recnop) (uint64_t recno) { $1 = &recno; }
 %typemap(frearg) (uint64_t *recnop) "";
@@ -896,6 +907,65 @@ typedef int int_void;
 		return (cursorFreeHandler($self));
 	}
 
+	/*
+	 * search_batch: the keys are a list of packed keys, the values are
+	 * returned as a list of packed values, None for keys not found.
+	 */
+	int_void _search_batch(PyObject *keys, PyObject **valuesp) {
+		PyObject *list, *v;
+		WT_ITEM *items, *values;
+		Py_ssize_t count, i;
+		int ret, *results;
+
+		if (!PyList_Check(keys)) {
+			SWIG_Error(SWIG_TypeError,
+			    "search_batch keys must be a list");
+			return (EINVAL);
+		}
+		count = PyList_Size(keys);
+
+		/* Allocate an extra entry, an empty batch is legal. */
+		items = values = NULL;
+		results = NULL;
+		if ((ret = __wt_calloc_def(NULL, (size_t)count + 1, &items)) != 0 ||
+		    (ret = __wt_calloc_def(NULL, (size_t)count + 1, &values)) != 0 ||
+		    (ret = __wt_calloc_def(NULL, (size_t)count + 1, &results)) != 0)
+			goto err;
+		for (i = 0; i < count; i++)
+			if (unpackBytesOrString(PyList_GetItem(keys, i),
+			    (void **)&items[i].data, &items[i].size) != 0) {
+				SWIG_Error(SWIG_TypeError,
+				    "bad key value for search_batch");
+				ret = EINVAL;
+				goto err;
+			}
+
+		if ((ret = $self->search_batch(
+		    $self, (size_t)count, items, values, results)) != 0)
+			goto err;
+
+		if ((list = PyList_New(count)) == NULL) {
+			ret = ENOMEM;
+			goto err;
+		}
+		for (i = 0; i < count; i++) {
+			if (results[i] == 0)
+				v = PyBytes_FromStringAndSize(
+				    values[i].data, (Py_ssize_t)values[i].size);
+			else {
+				Py_INCREF(Py_None);
+				v = Py_None;
+			}
+			PyList_SetItem(list, i, v);
+		}
+		*valuesp = list;
+
+err:		__wt_free(NULL, items);
+		__wt_free(NULL, values);
+		__wt_free(NULL, results);
+		return (ret);
+	}
+
 	/*
 	 * modify: the size of the array was put into the first element by the
 	 * typemap.
@@ -951,6 +1021,30 @@ typedef int int_void;
 		else:
 			return unpack(self.value_format, self._get_value())
 
+	def search_batch(self, keys):
+		'''search_batch(self, keys) -> [object, ...]
+
+		@copydoc WT_CURSOR::search_batch
+		Takes a list of keys, and returns a list of the values found for
+		the keys, in the same order, with None for each key not found.'''
+		if self.is_json:
+			raise WiredTigerError('search_batch is not supported for JSON cursors')
+		packed = []
+		for key in keys:
+			if type(key) != tuple:
+				key = (key,)
+			if self.is_column:
+				key = (_wt_recno(key[0]),)
+			packed.append(pack(self.key_format, *key))
+		results = []
+		for value in self._search_batch(packed):
+			if value is not None:
+				value = unpack(self.value_format, value)
+				if len(value) == 1:
+					value = value[0]
+			results.append(value)
+		return results
+
 	def get_raw_key_value(self):
 		'''get_raw_key_value(self) -> object
 
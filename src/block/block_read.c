@@ -58,6 +58,189 @@ err:
     return (ret);
 }
 
+/*
+ * __block_read_async_submit --
+ *     Start the session's pending coalesced read.
+ */
+static int
+__block_read_async_submit(WT_SESSION_IMPL *session, WT_BLOCK_MGR_SESSION *bms)
+{
+    WT_DECL_RET;
+
+    if (bms->io_pend_blocks == 0)
+        return (0);
+
+    ret = __wt_read_async(session, bms->io_pend_fh, bms->io_pend_offset, bms->io_pend_len,
+      &bms->io_req[bms->io_req_cnt]);
+    if (ret == 0) {
+        bms->io_req_blocks[bms->io_req_cnt] = bms->io_pend_blocks;
+        ++bms->io_req_cnt;
+    }
+    bms->io_pend_fh = NULL;
+    bms->io_pend_blocks = 0;
+    return (ret);
+}
+
+/*
+ * __wt_bm_read_async --
+ *     Start an asynchronous read of an address cookie referenced block. The read is consumed by the
+ *     session's next read of the same block, or discarded by the session. A block that directly
+ *     follows the previous block requested is added to the same read.
+ */
+int
+__wt_bm_read_async(WT_BM *bm, WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size)
+{
+    WT_BLOCK *block;
+    WT_BLOCK_MGR_SESSION *bms;
+    wt_off_t offset;
+    uint32_t checksum, objectid, size;
+
+    block = bm->block;
+
+    /*
+     * Multi-handle trees would have to hold the object's block handle until the read is consumed,
+     * and the chunk cache reads blocks on its own terms, don't bother with either.
+     */
+    if (bm->is_multi_handle || F_ISSET(&S2C(session)->chunkcache, WT_CHUNKCACHE_CONFIGURED))
+        return (0);
+
+    if ((bms = session->block_manager) == NULL) {
+        WT_RET(__wti_block_ext_prealloc(session, 0));
+        bms = session->block_manager;
+    }
+    if (bms->io_req == NULL) {
+        WT_RET(__wt_calloc_def(session, WT_BLOCK_READ_ASYNC_MAX, &bms->io_req));
+        WT_RET(__wt_calloc_def(session, WT_BLOCK_READ_ASYNC_MAX, &bms->io_req_blocks));
+    }
+
+    /* Crack the cookie. */
+    WT_RET(__wt_block_addr_unpack(
+      session, block, addr, addr_size, &objectid, &offset, &size, &checksum));
+
+    /* Extend the pending read if the block directly follows it. */
+    if (bms->io_pend_blocks != 0 && bms->io_pend_fh == block->fh &&
+      bms->io_pend_offset + (wt_off_t)bms->io_pend_len == offset &&
+      bms->io_pend_len + size <= WT_BLOCK_READ_COALESCE_MAX) {
+        bms->io_pend_len += size;
+        ++bms->io_pend_blocks;
+        WT_STAT_CONN_INCR(session, block_read_async_coalesced);
+        return (0);
+    }
+
+    /* Otherwise start the pending read and make this block the start of the next one. */
+    WT_RET(__block_read_async_submit(session, bms));
+    if (bms->io_req_cnt == WT_BLOCK_READ_ASYNC_MAX)
+        return (0);
+
+    bms->io_pend_fh = block->fh;
+    bms->io_pend_offset = offset;
+    bms->io_pend_len = size;
+    bms->io_pend_blocks = 1;
+    return (0);
+}
+
+/*
+ * __block_read_async_take --
+ *     Check for an asynchronous read of a block started by the session, and if found, wait for it
+ *     and return the block in the buffer.
+ */
+static int
+__block_read_async_take(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t offset, uint32_t size,
+  size_t bufsize, WT_ITEM *buf, bool *hitp)
+{
+    WT_BLOCK_MGR_SESSION *bms;
+    WT_DECL_RET;
+    WT_IO_REQ *req;
+    u_int i;
+
+    *hitp = false;
+
+    if ((bms = session->block_manager) == NULL)
+        return (0);
+
+    /* Reads are started when a block is consumed, so the whole batch is in flight at once. */
+    WT_RET(__block_read_async_submit(session, bms));
+    if (bms->io_req_cnt == 0)
+        return (0);
+
+    for (i = 0;; ++i) {
+        if (i == bms->io_req_cnt)
+            return (0);
+        req = &bms->io_req[i];
+        if (req->fh == block->fh && req->offset <= offset &&
+          offset + (wt_off_t)size <= req->offset + (wt_off_t)req->len)
+            break;
+    }
+
+    if ((ret = __wt_read_async_wait(session, req)) == 0) {
+        if (req->offset == offset && req->len == size) {
+            /*
+             * Hand the read buffer's memory to the caller. Only the memory moves, the caller's
+             * buffer flags (for example, a scratch buffer's in-use flag), stay with the caller's
+             * buffer.
+             */
+            __wt_free(session, buf->mem);
+            buf->mem = req->buf.mem;
+            buf->memsize = req->buf.memsize;
+            buf->data = buf->mem;
+            buf->size = size;
+            F_SET(buf, WT_ITEM_ALIGNED);
+            WT_CLEAR(req->buf);
+        } else {
+            /* Copy the block out of a coalesced read. */
+            WT_RET(__wt_buf_init(session, buf, bufsize));
+            buf->size = size;
+            memcpy(buf->mem, (uint8_t *)req->buf.mem + (size_t)(offset - req->offset), size);
+        }
+
+        *hitp = true;
+        WT_STAT_CONN_INCR(session, block_read_async_hit);
+
+        /* Keep a coalesced read until its last block is consumed. */
+        if (--bms->io_req_blocks[i] != 0)
+            return (0);
+    }
+
+    /* Remove the request, preserving the order doesn't matter. */
+    __wt_buf_free(session, &req->buf);
+    if (i != --bms->io_req_cnt) {
+        *req = bms->io_req[bms->io_req_cnt];
+        bms->io_req_blocks[i] = bms->io_req_blocks[bms->io_req_cnt];
+        WT_CLEAR(bms->io_req[bms->io_req_cnt]);
+    }
+    return (ret);
+}
+
+/*
+ * __wt_block_read_async_discard --
+ *     Wait for and discard any asynchronous reads started by the session that weren't consumed.
+ */
+int
+__wt_block_read_async_discard(WT_SESSION_IMPL *session)
+{
+    WT_BLOCK_MGR_SESSION *bms;
+    WT_DECL_RET;
+    WT_IO_REQ *req;
+    u_int i;
+
+    if ((bms = session->block_manager) == NULL)
+        return (0);
+
+    /* A pending read hasn't been started, there's nothing to wait for. */
+    bms->io_pend_fh = NULL;
+    bms->io_pend_blocks = 0;
+
+    for (i = 0; i < bms->io_req_cnt; ++i) {
+        req = &bms->io_req[i];
+        WT_TRET(__wt_read_async_wait(session, req));
+        __wt_buf_free(session, &req->buf);
+        WT_CLEAR(*req);
+    }
+    WT_STAT_CONN_INCRV(session, block_read_async_discard, bms->io_req_cnt);
+    bms->io_req_cnt = 0;
+    return (ret);
+}
+
 /*
  * __bm_corrupt_dump --
  *     Dump a block into the log in 1KB chunks.
@@ -168,9 +351,9 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
     WT_BLOCK_HEADER *blk, swap;
     size_t bufsize, check_size;
     int failures, max_failures;
-    bool chunkcache_hit, full_checksum_mismatch;
+    bool async_hit, chunkcache_hit, full_checksum_mismatch;
 
-    chunkcache_hit = full_checksum_mismatch = false;
+    async_hit = chunkcache_hit = full_checksum_mismatch = false;
     check_size = 0;
     failures = 0;
     max_failures = F_ISSET(&S2C(session)->chunkcache, WT_CHUNKCACHE_CONFIGURED) ? 2 : 1;
@@ -203,12 +386,18 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
           "%s: impossibly small block size of %" PRIu32 "B, less than allocation size of %" PRIu32,
           block->name, size, block->allocsize);
 
-    WT_RET(__wt_buf_init(session, buf, bufsize));
-    buf->size = size;
+    /* Check for an asynchronous read of the block, otherwise prepare the buffer. */
+    WT_RET(__block_read_async_take(session, block, offset, size, bufsize, buf, &async_hit));
+    if (!async_hit) {
+        WT_RET(__wt_buf_init(session, buf, bufsize));
+        buf->size = size;
+    }
 
     while (failures < max_failures) {
         full_checksum_mismatch = false;
-        if (F_ISSET(&S2C(session)->chunkcache, WT_CHUNKCACHE_CONFIGURED)) {
+        if (async_hit) {
+            /* The block has already been read. */
+        } else if (F_ISSET(&S2C(session)->chunkcache, WT_CHUNKCACHE_CONFIGURED)) {
             if (failures == 0) {
                 /*
                  * Check if the chunk cache has the needed data. If there is a miss in the chunk
@@ -222,7 +411,7 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
                   ENOSPC);
             }
         }
-        if (!chunkcache_hit || failures > 0) {
+        if (!async_hit && (!chunkcache_hit || failures > 0)) {
             __wt_capacity_throttle(session, size, WT_THROTTLE_READ);
             WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
         }
@@ -247,6 +436,15 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
             }
             full_checksum_mismatch = true;
         }
+
+        /*
+         * The block may have been freed and rewritten after an asynchronous read was started, read
+         * it again before treating the mismatch as a failure.
+         */
+        if (async_hit) {
+            async_hit = false;
+            continue;
+        }
         failures++;
 
         /*
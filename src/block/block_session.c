@@ -254,6 +254,10 @@ __block_manager_session_cleanup(WT_SESSION_IMPL *session)
     WT_TRET(__block_ext_discard(session, 0));
     WT_TRET(__block_size_discard(session, 0));
 
+    WT_TRET(__wt_block_read_async_discard(session));
+    __wt_free(session, ((WT_BLOCK_MGR_SESSION *)session->block_manager)->io_req);
+    __wt_free(session, ((WT_BLOCK_MGR_SESSION *)session->block_manager)->io_req_blocks);
+
     __wt_free(session, session->block_manager);
 
     return (ret);
@@ -141,138 +141,153 @@ __blkcache_high_overhead(WT_SESSION_IMPL *session)
 }
 
 /*
- * __blkcache_should_evict --
- *     Decide if the block should be evicted.
+ * __blkcache_item_match --
+ *     Return if a block cache item matches a file and address cookie.
  */
-static bool
-__blkcache_should_evict(WT_SESSION_IMPL *session, WT_BLKCACHE_ITEM *blkcache_item, int *reason)
+static WT_INLINE bool
+__blkcache_item_match(
+  WT_BLKCACHE_ITEM *blkcache_item, uint32_t fid, const uint8_t *addr, size_t addr_size)
+{
+    return (blkcache_item->addr_size == addr_size && blkcache_item->fid == fid &&
+      memcmp(blkcache_item->addr, addr, addr_size) == 0);
+}
+
+/*
+ * __blkcache_evict --
+ *     Run the eviction clock until the cache is below its target or every block has been swept past
+ *     enough times to have dropped its usage count to zero.
+ */
+static void
+__blkcache_evict(WT_SESSION_IMPL *session)
 {
     WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_ITEM *blkcache_item, **evicted;
+    WT_BLKCACHE_ITEM *volatile *prevp;
+    size_t evict_max, evicted_alloc, evicted_cnt, i;
+    uint64_t max_visits, visits;
+    u_int bucket;
 
     blkcache = &S2C(session)->blkcache;
-    *reason = WT_BLKCACHE_EVICT_OTHER;
-
-    /* Blocks in use cannot be evicted. */
-    if (blkcache_item->ref_count != 0)
-        return (false);
+    evicted = NULL;
+    evicted_alloc = evicted_cnt = 0;
 
     /*
-     * Keep track of the smallest number of references for blocks that have not been recently
-     * accessed.
+     * The clock hand moves a bucket at a time: blocks in use are skipped, blocks with a non-zero
+     * usage count have it decremented, and blocks the hand finds at zero are unlinked. Unlinking a
+     * block first marks it removed and then checks its reference count, lookups take a reference
+     * and then check the removed flag, so one of us always backs off.
      */
-    if ((blkcache_item->freq_rec_counter < blkcache->evict_aggressive) &&
-      (blkcache_item->num_references < blkcache->min_num_references))
-        blkcache->min_num_references = blkcache_item->num_references;
+    max_visits = (uint64_t)blkcache->hash_size * (WT_BLKCACHE_CLOCK_MAX + 1);
+    for (visits = 0; visits < max_visits && blkcache->bytes_used >= blkcache->full_target &&
+         !blkcache->blkcache_exiting;
+         ++visits) {
+        bucket = blkcache->evict_clock_hand;
+        if (++blkcache->evict_clock_hand == blkcache->hash_size)
+            blkcache->evict_clock_hand = 0;
+        if (blkcache->hash[bucket] == NULL)
+            continue;
 
-    /* Don't evict if there is plenty of free space */
-    if (blkcache->bytes_used < blkcache->full_target)
-        return (false);
+        /*
+         * Make room for the blocks we might evict from the bucket before locking it, the hand moves
+         * on when there's no more room and the rest of the bucket waits for its next visit.
+         */
+        if (__wt_realloc_def(
+              session, &evicted_alloc, evicted_cnt + WT_BLKCACHE_EVICT_BUCKET_MAX, &evicted) != 0)
+            break;
+        evict_max = evicted_cnt + WT_BLKCACHE_EVICT_BUCKET_MAX;
+
+        __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
+        for (prevp = &blkcache->hash[bucket];
+             evicted_cnt < evict_max && (blkcache_item = *prevp) != NULL;) {
+            if (blkcache_item->ref_count != 0) {
+                prevp = &blkcache_item->next;
+                continue;
+            }
+            if (blkcache_item->clock_count > 0) {
+                --blkcache_item->clock_count;
+                prevp = &blkcache_item->next;
+                continue;
+            }
+            blkcache_item->removed = true;
+            WT_FULL_BARRIER();
+            if (blkcache_item->ref_count != 0) {
+                blkcache_item->removed = false;
+                prevp = &blkcache_item->next;
+                continue;
+            }
+            WT_RELEASE_WRITE(*prevp, blkcache_item->next);
+            __blkcache_update_ref_histogram(session, blkcache_item, WT_BLKCACHE_RM_EVICTION);
+            (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
+            evicted[evicted_cnt++] = blkcache_item;
+        }
+        __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
+    }
 
-    /*
-     * In an NVRAM cache, don't evict if there is high overhead due to blocks being
-     * inserted/removed. Churn kills performance and evicting when churn is high will exacerbate the
-     * overhead.
-     */
-    if (blkcache->type == WT_BLKCACHE_NVRAM && __blkcache_high_overhead(session)) {
-        WT_STAT_CONN_INCR(session, block_cache_not_evicted_overhead);
-        return (false);
+    if (evicted_cnt == 0) {
+        __wt_free(session, evicted);
+        return;
     }
 
-    /*
-     * Evict if the block has not been accessed for the amount of time corresponding to the evict
-     * aggressive setting. Within the category of blocks that fit this criterion, choose those with
-     * the lowest number of accesses first.
-     */
-    if (blkcache_item->freq_rec_counter < blkcache->evict_aggressive &&
-      blkcache_item->num_references < (blkcache->min_num_references + WT_BLKCACHE_MINREF_INCREMENT))
-        return (true);
+    /* Wait for lookups that might have seen the evicted blocks before freeing them. */
+    __wt_gen_next_drain(session, WT_GEN_BLKCACHE);
+
+    for (i = 0; i < evicted_cnt; ++i) {
+        blkcache_item = evicted[i];
+        __blkcache_free(session, blkcache_item->data);
+
+        /*
+         * Update the number of removals because it is used to estimate the overhead, and we want
+         * the overhead contributed by eviction to be part of that calculation.
+         */
+        blkcache->removals++;
 
-    *reason = WT_BLKCACHE_NOT_EVICTION_CANDIDATE;
-    return (false);
+        WT_STAT_CONN_INCR(session, block_cache_blocks_evicted);
+        WT_STAT_CONN_DECRV(session, block_cache_bytes, blkcache_item->data_size);
+        WT_STAT_CONN_DECR(session, block_cache_blocks);
+        __wt_free(session, blkcache_item);
+    }
+    __wt_free(session, evicted);
 }
 
 /*
  * __blkcache_eviction_thread --
- *     Periodically sweep the cache and evict unused blocks.
+ *     Evict unused blocks when the cache is full.
  */
 static WT_THREAD_RET
 __blkcache_eviction_thread(void *arg)
 {
     WT_BLKCACHE *blkcache;
-    WT_BLKCACHE_ITEM *blkcache_item, *blkcache_item_tmp;
     WT_SESSION_IMPL *session;
-    int i, reason;
-    bool no_eviction_candidates;
 
     session = (WT_SESSION_IMPL *)arg;
     blkcache = &S2C(session)->blkcache;
 
     __wt_verbose(session, WT_VERB_BLKCACHE,
-      "Block cache eviction thread starting... "
-      "Aggressive target = %d, full target = %" PRIu64 ":",
-      blkcache->evict_aggressive, blkcache->full_target);
+      "Block cache eviction thread starting... full target = %" PRIu64 ":", blkcache->full_target);
 
     while (!blkcache->blkcache_exiting) {
-        /*
-         * Sweep the cache every second to ensure time-based decay of frequency/recency counters of
-         * resident blocks.
-         */
-        __wt_sleep(1, 0);
+        /* Wait until a block insert fills the cache, or a second has passed. */
+        __wt_cond_wait(session, blkcache->evict_cond, WT_MILLION, NULL);
 
         /* Check if the cache is being destroyed */
         if (blkcache->blkcache_exiting)
             return (WT_THREAD_RET_VALUE);
 
+        /* Don't evict if there is plenty of free space */
+        if (blkcache->bytes_used < blkcache->full_target)
+            continue;
+
         /*
-         * Walk the cache, gathering statistics and evicting blocks that are within our target. We
-         * sweep the cache every second, decrementing the frequency/recency counter of each block.
-         * Blocks whose counter goes below the threshold will get evicted. The threshold is set
-         * according to how soon we expect the blocks to become irrelevant. For example, if the
-         * threshold is set to 1800 seconds (=30 minutes), blocks that were used once but then
-         * weren't referenced for 30 minutes will be evicted. Blocks that were referenced a lot in
-         * the past but weren't referenced in the past 30 minutes will stay in the cache a bit
-         * longer, until their frequency/recency counter drops below the threshold.
-         *
-         * As we cycle through the blocks, we keep track of the minimum number of references
-         * observed for blocks whose frequency/recency counter has gone below the threshold. We will
-         * evict blocks with the smallest counter before evicting those with a larger one.
+         * In an NVRAM cache, don't evict if there is high overhead due to blocks being
+         * inserted/removed. Churn kills performance and evicting when churn is high will exacerbate
+         * the overhead.
          */
-        no_eviction_candidates = true;
-        for (i = 0; i < (int)blkcache->hash_size; i++) {
-            __wt_spin_lock(session, &blkcache->hash_locks[i]);
-            TAILQ_FOREACH_SAFE(blkcache_item, &blkcache->hash[i], hashq, blkcache_item_tmp)
-            {
-                if (__blkcache_should_evict(session, blkcache_item, &reason)) {
-                    TAILQ_REMOVE(&blkcache->hash[i], blkcache_item, hashq);
-                    __blkcache_free(session, blkcache_item->data);
-                    __blkcache_update_ref_histogram(
-                      session, blkcache_item, WT_BLKCACHE_RM_EVICTION);
-                    (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
-
-                    /*
-                     * Update the number of removals because it is used to estimate the overhead,
-                     * and we want the overhead contributed by eviction to be part of that
-                     * calculation.
-                     */
-                    blkcache->removals++;
-
-                    WT_STAT_CONN_INCR(session, block_cache_blocks_evicted);
-                    WT_STAT_CONN_DECRV(session, block_cache_bytes, blkcache_item->data_size);
-                    WT_STAT_CONN_DECR(session, block_cache_blocks);
-                    __wt_free(session, blkcache_item);
-                } else {
-                    blkcache_item->freq_rec_counter--;
-                    if (reason != WT_BLKCACHE_NOT_EVICTION_CANDIDATE)
-                        no_eviction_candidates = false;
-                }
-            }
-            __wt_spin_unlock(session, &blkcache->hash_locks[i]);
-            if (blkcache->blkcache_exiting)
-                return (WT_THREAD_RET_VALUE);
+        if (blkcache->type == WT_BLKCACHE_NVRAM && __blkcache_high_overhead(session)) {
+            WT_STAT_CONN_INCR(session, block_cache_not_evicted_overhead);
+            continue;
         }
-        if (no_eviction_candidates)
-            blkcache->min_num_references += WT_BLKCACHE_MINREF_INCREMENT;
 
+        __blkcache_evict(session);
         WT_STAT_CONN_INCR(session, block_cache_eviction_passes);
     }
     return (WT_THREAD_RET_VALUE);
@@ -357,19 +372,37 @@ __wti_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_si
 
     hash = __wt_hash_city64(addr, addr_size);
     bucket = hash % blkcache->hash_size;
-    __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
-    TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq) {
-        if (blkcache_item->addr_size == addr_size && blkcache_item->fid == S2BT(session)->id &&
-          memcmp(blkcache_item->addr, addr, addr_size) == 0) {
-            blkcache_item->num_references++;
-            if (blkcache_item->freq_rec_counter < 0)
-                blkcache_item->freq_rec_counter = 0;
-            blkcache_item->freq_rec_counter++;
+
+    /*
+     * Walk the hash chain without locking it: the block cache generation keeps blocks unlinked by
+     * concurrent threads from being freed until we're done. Once we've found the block, take a
+     * reference and then check it isn't being removed.
+     */
+    __wt_session_gen_enter(session, WT_GEN_BLKCACHE);
+    WT_ACQUIRE_READ(blkcache_item, blkcache->hash[bucket]);
+    while (blkcache_item != NULL) {
+        if (__blkcache_item_match(blkcache_item, S2BT(session)->id, addr, addr_size)) {
             (void)__wt_atomic_addv32(&blkcache_item->ref_count, 1);
+            WT_FULL_BARRIER();
+            if (blkcache_item->removed) {
+                (void)__wt_atomic_subv32(&blkcache_item->ref_count, 1);
+                blkcache_item = NULL;
+            }
             break;
         }
+        WT_ACQUIRE_READ(blkcache_item, blkcache_item->next);
+    }
+    __wt_session_gen_leave(session, WT_GEN_BLKCACHE);
+
+    /*
+     * Update the reference count and the CLOCK usage count without synchronization, they're only
+     * heuristics.
+     */
+    if (blkcache_item != NULL) {
+        blkcache_item->num_references++;
+        if (blkcache_item->clock_count < WT_BLKCACHE_CLOCK_MAX)
+            blkcache_item->clock_count++;
     }
-    __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
 
     if (blkcache_item != NULL) {
         *blkcache_retp = blkcache_item;
@@ -456,9 +489,9 @@ __wti_blkcache_put(
 #if !defined(HAVE_DIAGNOSTIC)
     if (!write)
 #endif
-        TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq)
-            if (blkcache_item->addr_size == addr_size && blkcache_item->fid == S2BT(session)->id &&
-              memcmp(blkcache_item->addr, addr, addr_size) == 0) {
+        for (blkcache_item = blkcache->hash[bucket]; blkcache_item != NULL;
+             blkcache_item = blkcache_item->next)
+            if (__blkcache_item_match(blkcache_item, S2BT(session)->id, addr, addr_size)) {
                 __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
                 WT_ASSERT(session, !write);
 
@@ -470,18 +503,23 @@ __wti_blkcache_put(
             }
 
     /*
-     * Set the recency timestamp on newly inserted blocks to the maximum value to reduce the chance
-     * of them being evicted before they are reused.
+     * Give newly inserted blocks a usage count so they survive a sweep of the eviction clock before
+     * they are reused. Publish the block only after it's fully initialized, lookups don't lock the
+     * bucket.
      */
-    blkcache_store->freq_rec_counter = 1;
-
-    TAILQ_INSERT_HEAD(&blkcache->hash[bucket], blkcache_store, hashq);
+    blkcache_store->clock_count = 1;
+    blkcache_store->next = blkcache->hash[bucket];
+    WT_RELEASE_WRITE(blkcache->hash[bucket], blkcache_store);
 
     (void)__wt_atomic_add64(&blkcache->bytes_used, data->size);
     blkcache->inserts++;
 
     __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
 
+    /* Wake the eviction thread if the cache is full. */
+    if (blkcache->bytes_used >= blkcache->full_target)
+        __wt_cond_signal(session, blkcache->evict_cond);
+
     WT_STAT_CONN_INCRV(session, block_cache_bytes, data->size);
     WT_STAT_CONN_INCR(session, block_cache_blocks);
     if (write) {
@@ -511,7 +549,8 @@ __wti_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr
 {
     WT_BLKCACHE *blkcache;
     WT_BLKCACHE_ITEM *blkcache_item;
-    uint64_t bucket, hash, sleep_usecs, total_usecs, yield_count;
+    WT_BLKCACHE_ITEM *volatile *prevp;
+    uint64_t bucket, gen, hash, sleep_usecs, total_usecs, yield_count;
 
     blkcache = &S2C(session)->blkcache;
     hash = __wt_hash_city64(addr, addr_size);
@@ -519,34 +558,49 @@ __wti_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr
     sleep_usecs = total_usecs = yield_count = 0;
 
     __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
-    TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq) {
-        if (blkcache_item->addr_size == addr_size && blkcache_item->fid == S2BT(session)->id &&
-          memcmp(blkcache_item->addr, addr, addr_size) == 0) {
-            TAILQ_REMOVE(&blkcache->hash[bucket], blkcache_item, hashq);
-            __blkcache_update_ref_histogram(session, blkcache_item, WT_BLKCACHE_RM_FREE);
-            __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
-            (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
-            WT_STAT_CONN_DECRV(session, block_cache_bytes, blkcache_item->data_size);
-            /*
-             * The block might be in use by another thread, wait for it to be released before
-             * freeing it.
-             */
-            while (blkcache_item->ref_count != 0) {
-                __wt_spin_backoff(&yield_count, &sleep_usecs);
-                total_usecs += sleep_usecs;
-            }
-            WT_STAT_CONN_INCRV(session, block_cache_blocks_removed_blocked, total_usecs);
-            __blkcache_free(session, blkcache_item->data);
-            __wt_overwrite_and_free(session, blkcache_item);
-            blkcache->removals++;
-            WT_STAT_CONN_INCR(session, block_cache_blocks_removed);
-            WT_STAT_CONN_DECR(session, block_cache_blocks);
-            __blkcache_verbose(
-              session, WT_VERBOSE_DEBUG_1, "block removed from cache", hash, addr, addr_size);
-            return;
-        }
+    for (prevp = &blkcache->hash[bucket]; (blkcache_item = *prevp) != NULL;
+         prevp = &blkcache_item->next)
+        if (__blkcache_item_match(blkcache_item, S2BT(session)->id, addr, addr_size))
+            break;
+    if (blkcache_item == NULL) {
+        __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
+        return;
     }
+
+    /* Mark the block removed so lookups stop taking references, then unlink it. */
+    blkcache_item->removed = true;
+    WT_FULL_BARRIER();
+    WT_RELEASE_WRITE(*prevp, blkcache_item->next);
+    __blkcache_update_ref_histogram(session, blkcache_item, WT_BLKCACHE_RM_FREE);
     __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
+
+    (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
+    WT_STAT_CONN_DECRV(session, block_cache_bytes, blkcache_item->data_size);
+
+    /* The block might be in use by another thread, wait for it to be released before freeing it. */
+    while (blkcache_item->ref_count != 0) {
+        __wt_spin_backoff(&yield_count, &sleep_usecs);
+        total_usecs += sleep_usecs;
+    }
+    WT_STAT_CONN_INCRV(session, block_cache_blocks_removed_blocked, total_usecs);
+    __blkcache_free(session, blkcache_item->data);
+
+    /*
+     * Lookups can still be walking through the block, stash it until they've finished. If we can't
+     * stash it, wait for them.
+     */
+    __wt_gen_next(session, WT_GEN_BLKCACHE, &gen);
+    if (__wt_stash_add(session, WT_GEN_BLKCACHE, gen, blkcache_item,
+          sizeof(*blkcache_item) + blkcache_item->addr_size) != 0) {
+        __wt_gen_next_drain(session, WT_GEN_BLKCACHE);
+        __wt_overwrite_and_free(session, blkcache_item);
+    }
+
+    blkcache->removals++;
+    WT_STAT_CONN_INCR(session, block_cache_blocks_removed);
+    WT_STAT_CONN_DECR(session, block_cache_blocks);
+    __blkcache_verbose(
+      session, WT_VERBOSE_DEBUG_1, "block removed from cache", hash, addr, addr_size);
 }
 
 /*
@@ -556,7 +610,7 @@ __wti_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr
 static int
 __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_int type,
   char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache, bool cache_on_writes,
-  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint)
+  u_int overhead_pct, uint64_t full_target, bool cache_on_checkpoint)
 {
     WT_BLKCACHE *blkcache;
     WT_DECL_RET;
@@ -589,16 +643,11 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
     WT_RET(__wt_calloc_def(session, blkcache->hash_size, &blkcache->hash));
     WT_RET(__wt_calloc_def(session, blkcache->hash_size, &blkcache->hash_locks));
 
-    for (i = 0; i < blkcache->hash_size; i++) {
-        TAILQ_INIT(&blkcache->hash[i]); /* Block cache hash lists */
+    for (i = 0; i < blkcache->hash_size; i++)
         WT_RET(__wt_spin_init(session, &blkcache->hash_locks[i], "block cache bucket locks"));
-    }
 
-    /* Create the eviction thread */
-    WT_RET(__wt_thread_create(
-      session, &blkcache->evict_thread_tid, __blkcache_eviction_thread, (void *)session));
-    blkcache->evict_aggressive = -((int)evict_aggressive);
-    blkcache->min_num_references = WT_THOUSAND; /* initialize to a large value */
+    /* The eviction thread is started once the connection can open sessions. */
+    WT_RET(__wt_cond_alloc(session, "block cache eviction", &blkcache->evict_cond));
 
     blkcache->type = type;
 
@@ -612,6 +661,28 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
     return (ret);
 }
 
+/*
+ * __wt_blkcache_evict_create --
+ *     Start the block cache eviction thread. The thread waits for lookups to finish before freeing
+ *     the blocks it evicts, give it a session of its own to wait in.
+ */
+int
+__wt_blkcache_evict_create(WT_SESSION_IMPL *session)
+{
+    WT_BLKCACHE *blkcache;
+
+    blkcache = &S2C(session)->blkcache;
+
+    if (blkcache->type == WT_BLKCACHE_UNCONFIGURED)
+        return (0);
+
+    WT_RET(__wt_open_internal_session(
+      S2C(session), "block-cache-evict", false, 0, 0, &blkcache->evict_session));
+    WT_RET(__wt_thread_create(blkcache->evict_session, &blkcache->evict_thread_tid,
+      __blkcache_eviction_thread, blkcache->evict_session));
+    return (0);
+}
+
 /*
  * __wt_blkcache_destroy --
  *     Destroy the block cache and free all memory.
@@ -633,14 +704,19 @@ __wt_blkcache_destroy(WT_SESSION_IMPL *session)
         return;
 
     blkcache->blkcache_exiting = true;
+    __wt_cond_signal(session, blkcache->evict_cond);
     WT_TRET(__wt_thread_join(session, &blkcache->evict_thread_tid));
     __wt_verbose(session, WT_VERB_BLKCACHE, "%s", "block cache eviction thread exited");
+    __wt_cond_destroy(session, &blkcache->evict_cond);
+    if (blkcache->evict_session != NULL) {
+        WT_TRET(__wt_session_close_internal(blkcache->evict_session));
+        blkcache->evict_session = NULL;
+    }
 
     for (i = 0; i < blkcache->hash_size; i++) {
         __wt_spin_lock(session, &blkcache->hash_locks[i]);
-        while (!TAILQ_EMPTY(&blkcache->hash[i])) {
-            blkcache_item = TAILQ_FIRST(&blkcache->hash[i]);
-            TAILQ_REMOVE(&blkcache->hash[i], blkcache_item, hashq);
+        while ((blkcache_item = blkcache->hash[i]) != NULL) {
+            blkcache->hash[i] = blkcache_item->next;
 
             /* Assert we never left a block pinned. */
             if (blkcache_item->ref_count != 0)
@@ -690,8 +766,7 @@ __wt_blkcache_destroy(WT_SESSION_IMPL *session)
 static int
 __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size, size_t hash_size,
   u_int type, char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache,
-  bool cache_on_writes, u_int overhead_pct, u_int evict_aggressive, uint64_t full_target,
-  bool cache_on_checkpoint)
+  bool cache_on_writes, u_int overhead_pct, uint64_t full_target, bool cache_on_checkpoint)
 {
     WT_BLKCACHE *blkcache;
 
@@ -705,7 +780,7 @@ __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size,
       blkcache->percent_file_in_os_cache != percent_file_in_os_cache ||
       blkcache->full_target != full_target || blkcache->max_bytes != cache_size ||
       blkcache->overhead_pct != overhead_pct || blkcache->system_ram != system_ram ||
-      blkcache->evict_aggressive != -((int)evict_aggressive) || blkcache->type != type ||
+      blkcache->type != type ||
       (nvram_device_path != NULL && blkcache->nvram_device_path == NULL) ||
       (nvram_device_path == NULL && blkcache->nvram_device_path != NULL) ||
       (nvram_device_path != NULL && blkcache->nvram_device_path != NULL &&
@@ -774,7 +849,7 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     WT_CONFIG_ITEM cval;
     WT_DECL_RET;
     uint64_t cache_size, full_target, system_ram;
-    u_int cache_type, evict_aggressive, hash_size, overhead_pct, percent_file_in_os_cache;
+    u_int cache_type, hash_size, overhead_pct, percent_file_in_os_cache;
     char *nvram_device_path;
     bool cache_on_checkpoint, cache_on_writes;
 
@@ -833,8 +908,13 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     if (cval.val == 0)
         cache_on_checkpoint = false;
 
-    WT_RET(__wt_config_gets(session, cfg, "block_cache.blkcache_eviction_aggression", &cval));
-    evict_aggressive = (u_int)cval.val;
+    /*
+     * The block cache evicts with a CLOCK, blocks no longer age out of the cache. The eviction
+     * aggression setting is deprecated and ignored, warn applications still setting it.
+     */
+    if (__wt_config_gets(session, cfg + 1, "block_cache.blkcache_eviction_aggression", &cval) == 0)
+        __wt_verbose_warning(session, WT_VERB_BLKCACHE, "%s",
+          "block_cache.blkcache_eviction_aggression is deprecated and has no effect");
 
     WT_RET(__wt_config_gets(session, cfg, "block_cache.full_target", &cval));
     full_target = (uint64_t)((float)cache_size * (float)cval.val / (float)100);
@@ -848,9 +928,9 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
 
     WT_RET(__blkcache_reconfig(session, reconfig, cache_size, hash_size, cache_type,
       nvram_device_path, system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct,
-      evict_aggressive, full_target, cache_on_checkpoint));
+      full_target, cache_on_checkpoint));
 
     return (__blkcache_init(session, cache_size, hash_size, cache_type, nvram_device_path,
-      system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct, evict_aggressive,
-      full_target, cache_on_checkpoint));
+      system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct, full_target,
+      cache_on_checkpoint));
 }
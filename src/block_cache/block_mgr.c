@@ -540,6 +540,16 @@ __bm_read(WT_BM *bm, WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr
     return (__wt_bm_read(bm, session, buf, addr, addr_size));
 }
 
+/*
+ * __bm_read_async --
+ *     Start an asynchronous read of an address cookie referenced block.
+ */
+static int
+__bm_read_async(WT_BM *bm, WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size)
+{
+    return (__wt_bm_read_async(bm, session, addr, addr_size));
+}
+
 /*
  * __bm_salvage_end --
  *     End a block manager salvage.
@@ -928,6 +938,7 @@ __wti_bm_method_set(WT_BM *bm, bool readonly)
     bm->is_mapped = __bm_is_mapped;
     bm->map_discard = __bm_map_discard;
     bm->read = __bm_read;
+    bm->read_async = __bm_read_async;
     bm->salvage_end = __bm_salvage_end;
     bm->salvage_next = __bm_salvage_next;
     bm->salvage_start = __bm_salvage_start;
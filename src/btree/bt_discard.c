@@ -451,6 +451,9 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
     /* Free any allocated memory used by instantiated keys. */
     WT_ROW_FOREACH (page, rip, i)
         __wt_row_leaf_key_free(session, page, rip);
+
+    /* Free the search index. */
+    __wt_free(session, page->pg_row_srch_index);
 }
 
 /*
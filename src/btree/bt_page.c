@@ -62,6 +62,13 @@ __wt_page_alloc(
     page->type = type;
     __wt_evict_page_init(page);
 
+    /*
+     * The page's memory is placed on the node where it's first touched, that is, where we're
+     * running now. Record the node so the page is accounted to it and evicted by a local thread.
+     */
+    if (S2C(session)->numa_nodes > 1)
+        page->numa_node = (uint8_t)__wt_numa_node(session);
+
     switch (type) {
     case WT_PAGE_COL_FIX:
         page->entries = alloc_entries;
@@ -20,7 +20,7 @@ __wti_btree_prefetch(WT_SESSION_IMPL *session, WT_REF *ref)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_REF *next_ref;
-    uint64_t block_preload;
+    uint64_t block_preload, window;
 
     conn = S2C(session);
     block_preload = 0;
@@ -39,8 +39,8 @@ __wti_btree_prefetch(WT_SESSION_IMPL *session, WT_REF *ref)
      * was performed using the same home ref.
      *
      * In the event that we find this to be true, we perform pre-fetch for approximately the number
-     * of pages that were added to the queue (WT_PREFETCH_QUEUE_PER_TRIGGER). We then want to ensure
-     * that we will not pre-fetch from this ref for a while, and this is done by checking a counter.
+     * of pages that were added to the queue (the window). We then want to ensure that we will not
+     * pre-fetch from this ref for a while, and this is done by checking a counter.
      *
      * The counter variable prefetch_skipped_with_parent tracks the number of skips we have
      * performed on a particular ref. If the number of skips surpasses the number of pages that have
@@ -49,7 +49,7 @@ __wti_btree_prefetch(WT_SESSION_IMPL *session, WT_REF *ref)
      * pre-fetch from.
      */
     if (session->pf.prefetch_prev_ref_home == ref->home &&
-      session->pf.prefetch_skipped_with_parent < WT_PREFETCH_QUEUE_PER_TRIGGER) {
+      session->pf.prefetch_skipped_with_parent < session->pf.prefetch_window) {
         ++session->pf.prefetch_skipped_with_parent;
         WT_STAT_CONN_INCR(session, prefetch_skipped_same_ref);
         WT_STAT_CONN_INCR(session, prefetch_skipped);
@@ -58,11 +58,20 @@ __wti_btree_prefetch(WT_SESSION_IMPL *session, WT_REF *ref)
 
     session->pf.prefetch_skipped_with_parent = 0;
 
+    /*
+     * Size the read-ahead to the scan: start small when a session begins reading sequentially and
+     * double the window each time the scan keeps reading pages from disk or pre-fetch. A leaf found
+     * in cache without pre-fetch breaks the sequence, and the next trigger starts small again.
+     */
+    window = session->pf.prefetch_window == 0 ?
+      WT_PREFETCH_QUEUE_PER_TRIGGER_MIN :
+      WT_MIN(session->pf.prefetch_window * 2, WT_PREFETCH_QUEUE_PER_TRIGGER_MAX);
+    session->pf.prefetch_window = window;
+
     /* Load and decompress a set of pages into the block cache. */
     WT_INTL_FOREACH_BEGIN (session, ref->home, next_ref) {
         /* Don't let the pre-fetch queue get overwhelmed. */
-        if (conn->prefetch_queue_count > WT_MAX_PREFETCH_QUEUE ||
-          block_preload > WT_PREFETCH_QUEUE_PER_TRIGGER)
+        if (conn->prefetch_queue_count > WT_MAX_PREFETCH_QUEUE || block_preload >= window)
             break;
 
         /*
@@ -133,3 +142,27 @@ err:
     WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
     return (ret);
 }
+
+/*
+ * __wt_prefetch_read_async --
+ *     Start an asynchronous read of the block backing a ref queued for pre-fetch. The read is
+ *     consumed when the page is read into the cache.
+ */
+int
+__wt_prefetch_read_async(WT_SESSION_IMPL *session, WT_PREFETCH_QUEUE_ENTRY *pe)
+{
+    WT_ADDR_COPY addr;
+    WT_BM *bm;
+    WT_DECL_RET;
+
+    if (WT_REF_GET_STATE(pe->ref) != WT_REF_DISK)
+        return (0);
+
+    bm = S2BT(session)->bm;
+
+    WT_ENTER_GENERATION(session, WT_GEN_SPLIT);
+    if (__wt_ref_addr_copy(session, pe->ref, &addr) && !addr.del_set)
+        ret = bm->read_async(bm, session, addr.addr, addr.size);
+    WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
+    return (ret);
+}
@@ -506,8 +506,10 @@ skip_evict:
                  */
                 if (F_ISSET_ATOMIC_16(page, WT_PAGE_PREFETCH) || read_from_disk)
                     ++session->pf.prefetch_disk_read_count;
-                else
+                else {
                     session->pf.prefetch_disk_read_count = 0;
+                    session->pf.prefetch_window = 0;
+                }
             }
 
             __wt_evict_touch_page(session, page, LF_ISSET(WT_READ_INTERNAL_OP), wont_need);
@@ -363,11 +363,11 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
              * Update checkpoint IO tracking data if configured to log verbose progress messages.
              */
             if (conn->ckpt_timer_start.tv_sec > 0) {
-                conn->ckpt_write_bytes += __wt_atomic_loadsize(&page->memory_footprint);
-                ++conn->ckpt_write_pages;
+                (void)__wt_atomic_add64(
+                  &conn->ckpt_write_bytes, __wt_atomic_loadsize(&page->memory_footprint));
 
                 /* Periodically log checkpoint progress. */
-                if (conn->ckpt_write_pages % (5 * WT_THOUSAND) == 0)
+                if (__wt_atomic_add64(&conn->ckpt_write_pages, 1) % (5 * WT_THOUSAND) == 0)
                     __wt_checkpoint_progress(session, false);
             }
         }
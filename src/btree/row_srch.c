@@ -347,6 +347,178 @@ __check_leaf_key_range(
     return (0);
 }
 
+/*
+ * __search_srch_index_bound --
+ *     Return the first slot in a range of a leaf page's search index with a value greater than (or
+ *     greater than or equal to) a search value.
+ */
+static WT_INLINE uint32_t
+__search_srch_index_bound(const uint64_t *keys, uint32_t base, uint32_t limit, uint64_t v, bool eq)
+{
+    uint32_t half, i, n;
+
+    /*
+     * Halve the range until it's small, then count the remaining slots without branching, the final
+     * comparisons of a binary search are the badly predicted ones. The values are in a dense array
+     * with 8 per cache line, the last steps of the search don't touch more than one or two lines.
+     */
+    while (limit > 8) {
+        half = limit >> 1;
+        if (eq ? keys[base + half] <= v : keys[base + half] < v) {
+            base += half;
+            limit -= half;
+        } else
+            limit = half;
+    }
+    for (i = n = 0; i < limit; ++i)
+        n += eq ? keys[base + i] <= v : keys[base + i] < v;
+    return (base + n);
+}
+
+/*
+ * __search_srch_index_key --
+ *     Roll a copy of the leading bytes of a row-store leaf page's keys forward to the next key.
+ */
+static WT_INLINE void
+__search_srch_index_key(WT_CELL_UNPACK_KV *unpack, uint8_t *key, size_t *key_sizep)
+{
+    size_t len;
+
+    /* Prefix-compressed keys take their leading bytes from the previous key. */
+    len = WT_MIN(unpack->prefix, WT_ROW_SRCH_PREFIX_MAX + 8);
+    if (len < WT_ROW_SRCH_PREFIX_MAX + 8) {
+        memcpy(key + len, unpack->data, WT_MIN(unpack->size, WT_ROW_SRCH_PREFIX_MAX + 8 - len));
+        len += WT_MIN(unpack->size, WT_ROW_SRCH_PREFIX_MAX + 8 - len);
+    }
+    *key_sizep = len;
+}
+
+/*
+ * __search_srch_index_build --
+ *     Build the search index for a row-store leaf page.
+ */
+static int
+__search_srch_index_build(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+    WT_CELL_UNPACK_KV unpack;
+    WT_ROW_SRCH_INDEX *srch_index;
+    size_t first_size, key_size, prefix_len, size;
+    uint32_t slot;
+    uint8_t first[WT_ROW_SRCH_PREFIX_MAX + 8], key[WT_ROW_SRCH_PREFIX_MAX + 8];
+    void *p;
+
+    /*
+     * Keys on a page are sorted, so the prefix common to every key is the prefix common to the
+     * first and last keys. Walk the keys, building only their leading bytes, to find the last key.
+     * Overflow keys aren't on the page, and the page isn't indexed if it has any.
+     */
+    first_size = key_size = 0;
+    slot = 0;
+    WT_CELL_FOREACH_KV (session, page->dsk, unpack) {
+        if (unpack.type == WT_CELL_KEY_OVFL) {
+            F_SET_ATOMIC_16(page, WT_PAGE_SRCH_INDEX_SKIP);
+            return (0);
+        }
+        if (unpack.type != WT_CELL_KEY)
+            continue;
+        __search_srch_index_key(&unpack, key, &key_size);
+        if (slot++ == 0) {
+            memcpy(first, key, key_size);
+            first_size = key_size;
+        }
+    }
+    WT_CELL_FOREACH_END;
+    if (slot != page->entries) {
+        F_SET_ATOMIC_16(page, WT_PAGE_SRCH_INDEX_SKIP);
+        return (0);
+    }
+    for (prefix_len = 0; prefix_len < WT_MIN(first_size, key_size) &&
+         prefix_len < WT_ROW_SRCH_PREFIX_MAX && first[prefix_len] == key[prefix_len];
+         ++prefix_len)
+        ;
+
+    /* Allocate the index and its array of key values in one chunk. */
+    size = sizeof(WT_ROW_SRCH_INDEX) + page->entries * sizeof(uint64_t);
+    WT_RET(__wt_calloc(session, 1, size, &p));
+    srch_index = p;
+    srch_index->keys = (uint64_t *)(srch_index + 1);
+    srch_index->prefix_len = (uint32_t)prefix_len;
+    memcpy(srch_index->prefix, first, prefix_len);
+
+    slot = 0;
+    WT_CELL_FOREACH_KV (session, page->dsk, unpack) {
+        if (unpack.type != WT_CELL_KEY)
+            continue;
+        __search_srch_index_key(&unpack, key, &key_size);
+        srch_index->keys[slot++] = __wt_row_srch_index_key(key, key_size, prefix_len);
+    }
+    WT_CELL_FOREACH_END;
+
+    /*
+     * Serialize the swap of the index into place: on success, update the page's memory footprint,
+     * on failure, another thread built the index first, free the allocated memory.
+     */
+    if (__wt_atomic_cas_ptr(&page->pg_row_srch_index, NULL, srch_index))
+        __wt_cache_page_inmem_incr(session, page, size);
+    else
+        __wt_free(session, srch_index);
+    return (0);
+}
+
+/*
+ * __search_srch_index --
+ *     Use a leaf page's search index to narrow the range of slots the binary search of the page's
+ *     keys has to consider.
+ */
+static WT_INLINE int
+__search_srch_index(
+  WT_SESSION_IMPL *session, WT_PAGE *page, WT_ITEM *srch_key, uint32_t *basep, uint32_t *limitp)
+{
+    WT_ROW_SRCH_INDEX *srch_index;
+    uint64_t v;
+    uint32_t base, stop;
+    int cmp;
+
+    /*
+     * Build the index the first time the page is searched rather than when it's read into memory:
+     * building it costs two walks of the page's disk image and 8B per entry, wasted effort if the
+     * page is only read by a cursor in sorted order. Small pages aren't worth the memory, a search
+     * of them is only a few key comparisons.
+     */
+    WT_ACQUIRE_READ(srch_index, page->pg_row_srch_index);
+    if (srch_index == NULL) {
+        if (page->dsk == NULL || page->entries < WT_ROW_SRCH_INDEX_MIN ||
+          F_ISSET_ATOMIC_16(page, WT_PAGE_SRCH_INDEX_SKIP))
+            return (0);
+        WT_RET(__search_srch_index_build(session, page));
+        WT_ACQUIRE_READ(srch_index, page->pg_row_srch_index);
+        if (srch_index == NULL)
+            return (0);
+    }
+
+    /* A search key not starting with the page's common prefix sorts before or after every key. */
+    cmp =
+      memcmp(srch_key->data, srch_index->prefix, WT_MIN(srch_key->size, srch_index->prefix_len));
+    if (cmp == 0 && srch_key->size < srch_index->prefix_len)
+        cmp = -1;
+    if (cmp != 0) {
+        *basep = cmp < 0 ? 0 : page->entries;
+        *limitp = 0;
+        return (0);
+    }
+
+    /*
+     * Slots with smaller index values have smaller keys, slots with larger index values have larger
+     * keys, only keys with the same index value can match.
+     */
+    v = __wt_row_srch_index_key(srch_key->data, srch_key->size, srch_index->prefix_len);
+    base = __search_srch_index_bound(srch_index->keys, 0, page->entries, v, false);
+    stop = __search_srch_index_bound(srch_index->keys, base, page->entries - base, v, true);
+    *basep = base;
+    *limitp = stop - base;
+    return (0);
+}
+
 /*
  * __wt_row_search --
  *     Search a row-store tree for a specific key.
@@ -626,9 +798,14 @@ leaf_only:
      * Binary search of an leaf page. There are three versions (keys with no application-specified
      * collation order, in long and short versions, and keys with an application-specified collation
      * order), because doing the tests and error handling inside the loop costs about 5%.
+     *
+     * Without an application-specified collation order, use the page's search index to narrow the
+     * search first.
      */
     base = 0;
     limit = page->entries;
+    if (collator == NULL)
+        WT_ERR(__search_srch_index(session, page, srch_key, &base, &limit));
     if (collator == NULL && srch_key->size <= WT_COMPARE_SHORT_MAXLEN)
         for (; limit != 0; limit >>= 1) {
             indx = base + (limit >> 1);
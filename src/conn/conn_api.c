@@ -2838,7 +2838,7 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
     const WT_NAME_FLAG *ft;
     WT_SESSION *wt_session;
     WT_SESSION_IMPL *session, *verify_session;
-    bool config_base_set, try_salvage, verify_meta;
+    bool builtin_fs, config_base_set, try_salvage, verify_meta;
     const char *enc_cfg[] = {NULL, NULL}, *merge_cfg;
     char version[64];
 
@@ -2852,7 +2852,7 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
     conn = NULL;
     session = verify_session = NULL;
     merge_cfg = NULL;
-    try_salvage = false;
+    builtin_fs = try_salvage = false;
     WT_NOT_READ(config_base_set, false);
     WT_NOT_READ(verify_meta, false);
 
@@ -2935,6 +2935,7 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
      * If the application didn't configure its own file system, configure one of ours. Check to
      * ensure we have a valid file system.
      */
+    builtin_fs = conn->file_system == NULL;
     if (conn->file_system == NULL) {
         if (F_ISSET(conn, WT_CONN_IN_MEMORY))
             WT_ERR(__wt_os_inmemory(session));
@@ -3149,6 +3150,19 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
         WT_ERR_MSG(session, EINVAL,
           "pre-fetching cannot be enabled if pre-fetching is configured as unavailable");
 
+    WT_ERR(__wt_config_gets(session, cfg, "io_uring.enabled", &cval));
+    if (cval.val != 0) {
+        if (!builtin_fs || F_ISSET(conn, WT_CONN_IN_MEMORY))
+            WT_ERR_MSG(session, EINVAL,
+              "io_uring configuration is only supported by the built-in POSIX file system");
+        WT_ERR(__wt_config_gets(session, cfg, "io_uring.queue_depth", &cval));
+        WT_ERR(__wt_io_uring_create(session, (uint32_t)cval.val, &conn->io_uring));
+    }
+
+    WT_ERR(__wt_config_gets(session, cfg, "numa.enabled", &cval));
+    if (cval.val != 0)
+        WT_ERR(__wt_numa_setup(session, cfg));
+
     WT_ERR(__wt_config_gets(session, cfg, "salvage", &cval));
     if (cval.val) {
         if (F_ISSET(conn, WT_CONN_READONLY))
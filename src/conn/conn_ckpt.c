@@ -32,6 +32,9 @@ __ckpt_server_config(WT_SESSION_IMPL *session, const char **cfg, bool *startp)
     ckpt_logsize = (wt_off_t)cval.val;
     __wt_atomic_storei64(&conn->ckpt_logsize, ckpt_logsize);
 
+    WT_RET(__wt_config_gets(session, cfg, "checkpoint.threads", &cval));
+    __wt_atomic_store32(&conn->ckpt_threads, (uint32_t)cval.val);
+
     /*
      * The checkpoint configuration requires a wait time and/or a log size, if neither is set, we're
      * not running at all. Checkpoints based on log size also require logging be enabled.
@@ -8,6 +8,32 @@
 
 #include "wt_internal.h"
 
+/*
+ * __conn_stat_cpu_index --
+ *     Number the CPUs for choosing statistics slots: the CPUs the process can run on come first, in
+ *     order, so they map to different slots whenever there are enough slots to go around.
+ */
+static void
+__conn_stat_cpu_index(WT_CONNECTION_IMPL *conn)
+{
+#ifdef __linux__
+    cpu_set_t cpus;
+    uint16_t i, next;
+
+    /* The process's CPUs first, then any others it might later be allowed to run on. */
+    if (sched_getaffinity(0, sizeof(cpus), &cpus) != 0)
+        CPU_ZERO(&cpus);
+    for (next = 0, i = 0; i < WT_STAT_CPU_MAX; ++i)
+        if (i < CPU_SETSIZE && CPU_ISSET(i, &cpus))
+            conn->stat_cpu_index[i] = next++;
+    for (i = 0; i < WT_STAT_CPU_MAX; ++i)
+        if (i >= CPU_SETSIZE || !CPU_ISSET(i, &cpus))
+            conn->stat_cpu_index[i] = next++;
+#else
+    WT_UNUSED(conn);
+#endif
+}
+
 /*
  * __wti_connection_init --
  *     Structure initialization for a just-created WT_CONNECTION_IMPL handle.
@@ -48,6 +74,7 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
 
     /* Statistics. */
     WT_RET(__wt_stat_connection_init(session, conn));
+    __conn_stat_cpu_index(conn);
 
     /* Spinlocks. */
     WT_RET(__wt_spin_init(session, &conn->api_lock, "api"));
@@ -152,6 +179,9 @@ __wti_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_free(session, conn->dhhash);
     __wt_free(session, conn->fhhash);
 
+    /* Discard the NUMA topology. */
+    __wt_numa_destroy(session);
+
     /* Free allocated recovered checkpoint snapshot memory */
     __wt_free(session, conn->recovery_ckpt_snapshot);
 
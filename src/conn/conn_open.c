@@ -98,6 +98,7 @@ __wti_connection_close(WT_CONNECTION_IMPL *conn)
      */
     WT_TRET(__wti_background_compact_server_destroy(session));
     WT_TRET(__wti_checkpoint_server_destroy(session));
+    WT_TRET(__wt_checkpoint_threads_destroy(session));
     WT_TRET(__wti_statlog_destroy(session, true));
     WT_TRET(__wti_tiered_storage_destroy(session, false));
     WT_TRET(__wti_sweep_destroy(session));
@@ -105,6 +106,9 @@ __wti_connection_close(WT_CONNECTION_IMPL *conn)
     WT_TRET(__wti_chunkcache_metadata_destroy(session));
     WT_TRET(__wti_prefetch_destroy(session));
 
+    /* The pre-fetch threads are the only users of asynchronous reads. */
+    WT_TRET(__wt_io_uring_destroy(session, &conn->io_uring));
+
     /* The eviction server is shut down last. */
     WT_TRET(__wt_evict_threads_destroy(session));
     /* The capacity server can only be shut down after all I/O is complete. */
@@ -235,6 +239,9 @@ __wti_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
     WT_RET(__wti_tiered_storage_create(session));
     WT_RET(__wt_logmgr_create(session));
 
+    /* Start the block cache eviction thread, recovery can fill the block cache. */
+    WT_RET(__wt_blkcache_evict_create(session));
+
     /*
      * Run recovery. NOTE: This call will start (and stop) eviction if recovery is required.
      * Recovery must run before the history store table is created (because recovery will update the
@@ -19,27 +19,18 @@ __prefetch_thread_chk(WT_SESSION_IMPL *session)
 }
 
 /*
- * __prefetch_thread_run --
- *     Entry function for a prefetch thread. This is called repeatedly from the thread group code so
- *     it does not need to loop itself.
+ * __prefetch_queue_pop --
+ *     Remove the next ref to pre-fetch from the queue, returning NULL if there's no work to do.
  */
-static int
-__prefetch_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+static void
+__prefetch_queue_pop(WT_SESSION_IMPL *session, WT_PREFETCH_QUEUE_ENTRY **pep)
 {
     WT_CONNECTION_IMPL *conn;
-    WT_DECL_RET;
     WT_PREFETCH_QUEUE_ENTRY *pe;
 
-    WT_UNUSED(thread);
-    WT_ASSERT(session, session->id != 0);
+    *pep = NULL;
     conn = S2C(session);
 
-    /* Mark the session as a prefetch thread session. */
-    F_SET(session, WT_SESSION_PREFETCH_THREAD);
-
-    if (F_ISSET(conn, WT_CONN_PREFETCH_RUN))
-        __wt_cond_wait(session, conn->prefetch_threads.wait_cond, WT_THOUSAND * WT_THOUSAND, NULL);
-
     while (!TAILQ_EMPTY(&conn->pfqh)) {
         /* Encourage races. */
         __wt_timing_stress(session, WT_TIMING_STRESS_PREFETCH_1, NULL);
@@ -83,34 +74,103 @@ __prefetch_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
           session, F_ISSET_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH), prefetch_skipped_no_flag_set);
         __wt_spin_unlock(session, &conn->prefetch_lock);
 
-        /*
-         * It's a weird case, but if verify is utilizing prefetch and encounters a corrupted block,
-         * stop using prefetch. Some of the guarantees about ref and page freeing are ignored in
-         * that case, which can invalidate entries on the prefetch queue. Don't prefetch fast
-         * deleted pages - they have special performance and visibility considerations associated
-         * with them. Don't prefetch fast deleted pages to avoid wasted effort. We can skip reading
-         * these deleted pages into the cache if the fast truncate information is visible in the
-         * session transaction snapshot.
-         */
-        if (!F_ISSET(conn, WT_CONN_DATA_CORRUPTION) && pe->ref->page_del == NULL)
-            WT_WITH_DHANDLE(session, pe->dhandle, ret = __wt_prefetch_page_in(session, pe));
+        *pep = pe;
+        break;
+    }
+}
 
-        /*
-         * It is now safe to clear the flag. The prefetch worker is done interacting with the ref
-         * and the associated internal page can be safely evicted from now on.
-         */
-        F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
-        (void)__wt_atomic_subv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
+/*
+ * __prefetch_page_in --
+ *     Read a dequeued ref's page into the cache and discard the queue entry.
+ */
+static int
+__prefetch_page_in(WT_SESSION_IMPL *session, WT_PREFETCH_QUEUE_ENTRY *pe)
+{
+    WT_DECL_RET;
 
-        __wt_free(session, pe);
+    /*
+     * It's a weird case, but if verify is utilizing prefetch and encounters a corrupted block, stop
+     * using prefetch. Some of the guarantees about ref and page freeing are ignored in that case,
+     * which can invalidate entries on the prefetch queue. Don't prefetch fast deleted pages - they
+     * have special performance and visibility considerations associated with them. Don't prefetch
+     * fast deleted pages to avoid wasted effort. We can skip reading these deleted pages into the
+     * cache if the fast truncate information is visible in the session transaction snapshot.
+     */
+    if (!F_ISSET(S2C(session), WT_CONN_DATA_CORRUPTION) && pe->ref->page_del == NULL)
+        WT_WITH_DHANDLE(session, pe->dhandle, ret = __wt_prefetch_page_in(session, pe));
 
-        /*
-         * Ignore specific errors that prevented prefetch from making progress, they are harmless.
-         */
-        if (ret == WT_NOTFOUND || ret == WT_RESTART) {
-            WT_STAT_CONN_INCR(session, prefetch_skipped_error_ok);
-            ret = 0;
+    /*
+     * It is now safe to clear the flag. The prefetch worker is done interacting with the ref and
+     * the associated internal page can be safely evicted from now on.
+     */
+    F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
+    (void)__wt_atomic_subv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
+
+    __wt_free(session, pe);
+
+    /*
+     * Ignore specific errors that prevented prefetch from making progress, they are harmless.
+     */
+    if (ret == WT_NOTFOUND || ret == WT_RESTART) {
+        WT_STAT_CONN_INCR(session, prefetch_skipped_error_ok);
+        ret = 0;
+    }
+    return (ret);
+}
+
+/*
+ * __prefetch_thread_run --
+ *     Entry function for a prefetch thread. This is called repeatedly from the thread group code so
+ *     it does not need to loop itself.
+ */
+static int
+__prefetch_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_PREFETCH_QUEUE_ENTRY *batch[WT_BLOCK_READ_ASYNC_MAX], *pe;
+    u_int batch_max, i, n;
+
+    WT_UNUSED(thread);
+    WT_ASSERT(session, session->id != 0);
+    conn = S2C(session);
+
+    /* Mark the session as a prefetch thread session. */
+    F_SET(session, WT_SESSION_PREFETCH_THREAD);
+
+    if (F_ISSET(conn, WT_CONN_PREFETCH_RUN))
+        __wt_cond_wait(session, conn->prefetch_threads.wait_cond, WT_THOUSAND * WT_THOUSAND, NULL);
+
+    /*
+     * Dequeue a batch of refs and request reads of all of them before reading the first page into
+     * the cache: the block manager coalesces physically adjacent blocks into single reads. With
+     * asynchronous reads configured, the reads also proceed in parallel. The prefetch threads share
+     * the ring, divide its depth between them, but always batch at least two reads: reads that
+     * don't fit in the ring are done synchronously and are still consumed from the batch.
+     */
+    batch_max = WT_PREFETCH_SYNC_BATCH;
+    if (conn->io_uring != NULL)
+        batch_max = WT_MIN(
+          WT_BLOCK_READ_ASYNC_MAX, WT_MAX(2, conn->io_uring->depth / WT_PREFETCH_THREAD_COUNT));
+
+    while (!TAILQ_EMPTY(&conn->pfqh)) {
+        for (n = 0; n < batch_max; ++n) {
+            __prefetch_queue_pop(session, &pe);
+            if (pe == NULL)
+                break;
+            batch[n] = pe;
+            if (batch_max > 1 && !F_ISSET(conn, WT_CONN_DATA_CORRUPTION) &&
+              pe->ref->page_del == NULL)
+                WT_WITH_DHANDLE(
+                  session, pe->dhandle, WT_TRET(__wt_prefetch_read_async(session, pe)));
         }
+        if (n == 0)
+            break;
+
+        /* Every dequeued ref has to be released, even after an error. */
+        for (i = 0; i < n; ++i)
+            WT_TRET(__prefetch_page_in(session, batch[i]));
+        WT_TRET(__wt_block_read_async_discard(session));
         WT_ERR(ret);
     }
 
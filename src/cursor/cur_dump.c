@@ -404,6 +404,7 @@ __wti_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp)
       __curdump_reset,                              /* reset */
       __curdump_search,                             /* search */
       __curdump_search_near,                        /* search-near */
+      __wt_cursor_search_batch_notsup,              /* search-batch */
       __curdump_insert,                             /* insert */
       __wt_cursor_modify_notsup,                    /* modify */
       __curdump_update,                             /* update */
@@ -961,6 +961,7 @@ __curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[],
       __curfile_reset,                                /* reset */
       __curfile_search,                               /* search */
       __curfile_search_near,                          /* search-near */
+      __wt_cursor_search_batch,                       /* search-batch */
       __curfile_insert,                               /* insert */
       __wt_cursor_modify_value_format_notsup,         /* modify */
       __curfile_update,                               /* update */
@@ -571,6 +571,7 @@ __curjoin_entry_member(
       __wt_cursor_notsup,                             /* reset */
       __wt_cursor_notsup,                             /* search */
       __wt_cursor_search_near_notsup,                 /* search-near */
+      __wt_cursor_search_batch_notsup,                /* search-batch */
       __curjoin_extract_insert,                       /* insert */
       __wt_cursor_modify_notsup,                      /* modify */
       __wt_cursor_notsup,                             /* update */
@@ -1221,6 +1222,7 @@ __wt_curjoin_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, c
       __curjoin_reset,                              /* reset */
       __wt_cursor_notsup,                           /* search */
       __wt_cursor_search_near_notsup,               /* search-near */
+      __wt_cursor_search_batch_notsup,              /* search-batch */
       __wt_cursor_notsup,                           /* insert */
       __wt_cursor_modify_notsup,                    /* modify */
       __wt_cursor_notsup,                           /* update */
@@ -590,6 +590,7 @@ __wt_curmetadata_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owne
       __curmetadata_reset,                            /* reset */
       __curmetadata_search,                           /* search */
       __curmetadata_search_near,                      /* search-near */
+      __wt_cursor_search_batch,                       /* search-batch */
       __curmetadata_insert,                           /* insert */
       __wt_cursor_modify_notsup,                      /* modify */
       __curmetadata_update,                           /* update */
@@ -175,6 +175,22 @@ __wt_cursor_search_near_notsup(WT_CURSOR *cursor, int *exact)
     return (__wt_cursor_notsup(cursor));
 }
 
+/*
+ * __wt_cursor_search_batch_notsup --
+ *     Unsupported cursor search-batch.
+ */
+int
+__wt_cursor_search_batch_notsup(
+  WT_CURSOR *cursor, size_t count, WT_ITEM *keys, WT_ITEM *values, int *results)
+{
+    WT_UNUSED(count);
+    WT_UNUSED(keys);
+    WT_UNUSED(values);
+    WT_UNUSED(results);
+
+    return (__wt_cursor_notsup(cursor));
+}
+
 /*
  * __wt_cursor_config_notsup --
  *     Unsupported cursor API call which takes config.
@@ -1170,6 +1186,112 @@ err:
     API_END_RET_STAT(session, ret, cursor_equals);
 }
 
+/*
+ * __cursor_search_batch_cmp --
+ *     Qsort function: sort the search batch keys in byte order.
+ */
+static int WT_CDECL
+__cursor_search_batch_cmp(const void *a, const void *b)
+{
+    return (__wt_lex_compare(*(WT_ITEM **)a, *(WT_ITEM **)b));
+}
+
+/*
+ * __wt_cursor_search_batch --
+ *     WT_CURSOR->search_batch default implementation.
+ */
+int
+__wt_cursor_search_batch(
+  WT_CURSOR *cursor, size_t count, WT_ITEM *keys, WT_ITEM *values, int *results)
+{
+    WT_DECL_ITEM(buf);
+    WT_DECL_RET;
+    WT_ITEM **sorted, value;
+    WT_SESSION_IMPL *session;
+    size_t i, memsize, slot, *offsets;
+    void *mem;
+
+    offsets = NULL;
+    sorted = NULL;
+    CURSOR_API_CALL(cursor, session, ret, search_batch, NULL);
+    WT_STAT_CONN_DSRC_INCR(session, cursor_search_batch);
+
+    if (count == 0)
+        goto err;
+    WT_ERR(__wt_calloc_def(session, count, &sorted));
+    WT_ERR(__wt_calloc_def(session, count, &offsets));
+
+    /*
+     * Search for the keys in sorted order, neighboring keys are likely to be on the same leaf page
+     * and searches of a cursor's pinned page don't descend from the root of the tree. Byte order is
+     * the tree order for keys without a custom collator; otherwise the searches are less likely to
+     * hit the pinned page, but the results are the same.
+     */
+    for (i = 0; i < count; ++i)
+        sorted[i] = &keys[i];
+    __wt_qsort(sorted, count, sizeof(WT_ITEM *), __cursor_search_batch_cmp);
+
+    /*
+     * The values are copied into a single buffer, the returned items can't be set until all of the
+     * values are copied as the buffer may be reallocated. The cursor's value buffer can't be used
+     * for the copies, searches can return values that reference it.
+     */
+    WT_ERR(__wt_scr_alloc(session, 0, &buf));
+    for (i = 0; i < count; ++i) {
+        slot = WT_PTRDIFF(sorted[i], keys) / sizeof(WT_ITEM);
+        __wt_cursor_set_raw_key(cursor, sorted[i]);
+        if ((ret = cursor->search(cursor)) == WT_NOTFOUND) {
+            results[slot] = WT_NOTFOUND;
+            ret = 0;
+            continue;
+        }
+        WT_ERR(ret);
+        WT_ERR(__wt_cursor_get_raw_value(cursor, &value));
+
+        results[slot] = 0;
+        offsets[slot] = buf->size;
+        values[slot].size = value.size;
+        WT_ERR(__wt_buf_grow(session, buf, buf->size + value.size));
+        if (value.size != 0)
+            memcpy((uint8_t *)buf->mem + buf->size, value.data, value.size);
+        buf->size += value.size;
+    }
+    WT_ERR(cursor->reset(cursor));
+
+    /*
+     * Hand the values to the cursor's value buffer: the cursor owns the returned values until its
+     * next operation, the same as a value returned by WT_CURSOR::get_value. Only the memory moves,
+     * the scratch buffer keeps the cursor's old memory.
+     */
+    mem = cursor->value.mem;
+    memsize = cursor->value.memsize;
+    cursor->value.mem = buf->mem;
+    cursor->value.memsize = buf->memsize;
+    cursor->value.data = buf->mem;
+    cursor->value.size = buf->size;
+    buf->mem = mem;
+    buf->memsize = memsize;
+    buf->data = NULL;
+    buf->size = 0;
+
+    for (i = 0; i < count; ++i)
+        if (results[i] == 0)
+            values[i].data = (uint8_t *)cursor->value.mem + offsets[i];
+        else {
+            values[i].data = NULL;
+            values[i].size = 0;
+        }
+
+    if (0) {
+err:
+        WT_TRET(cursor->reset(cursor));
+    }
+    __wt_scr_free(session, &buf);
+    __wt_free(session, offsets);
+    __wt_free(session, sorted);
+    API_END_RET_STAT(session, ret, cursor_search_batch);
+}
+
 /*
  * __cursor_modify --
  *     WT_CURSOR->modify default implementation.
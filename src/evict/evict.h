@@ -91,6 +91,9 @@ struct __wt_evict {
     WT_EVICT_QUEUE *evict_urgent_queue;  /* LRU urgent queue */
     uint32_t evict_slots;                /* LRU list eviction slots */
 
+    /* Candidates found by eviction workers, merged into the queue the server is filling. */
+    WT_EVICT_QUEUE evict_stage_queues[WT_EVICT_STAGE_QUEUE_MAX];
+
 #define WT_EVICT_PRESSURE_THRESHOLD 0.95
 #define WT_EVICT_SCORE_BUMP 10
 #define WT_EVICT_SCORE_CUTOFF 10
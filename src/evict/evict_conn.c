@@ -222,6 +222,9 @@ __wt_evict_config(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     WT_RET(__wt_config_gets(session, cfg, "eviction.evict_sample_inmem", &cval));
     conn->evict_sample_inmem = cval.val != 0;
 
+    WT_RET(__wt_config_gets(session, cfg, "eviction.parallel_walk", &cval));
+    __wt_atomic_storebool(&conn->evict_parallel_walk, cval.val != 0);
+
     /* Retrieve the wait time and convert from milliseconds */
     WT_RET(__wt_config_gets(session, cfg, "cache_max_wait_ms", &cval));
     evict->cache_max_wait_us = (uint64_t)(cval.val * WT_THOUSAND);
@@ -295,6 +298,11 @@ __wt_evict_create(WT_SESSION_IMPL *session, const char *cfg[])
         WT_RET(__wt_calloc_def(session, evict->evict_slots, &evict->evict_queues[i].evict_queue));
         WT_RET(__wt_spin_init(session, &evict->evict_queues[i].evict_lock, "evict queue"));
     }
+    for (i = 0; i < WT_EVICT_STAGE_QUEUE_MAX; ++i) {
+        WT_RET(
+          __wt_calloc_def(session, WT_EVICT_WALK_INCR, &evict->evict_stage_queues[i].evict_queue));
+        WT_RET(__wt_spin_init(session, &evict->evict_stage_queues[i].evict_lock, "evict stage"));
+    }
 
     /* Ensure there are always non-NULL queues. */
     evict->evict_current_queue = evict->evict_fill_queue = &evict->evict_queues[0];
@@ -341,6 +349,10 @@ __wt_evict_destroy(WT_SESSION_IMPL *session)
         __wt_spin_destroy(session, &evict->evict_queues[i].evict_lock);
         __wt_free(session, evict->evict_queues[i].evict_queue);
     }
+    for (i = 0; i < WT_EVICT_STAGE_QUEUE_MAX; ++i) {
+        __wt_spin_destroy(session, &evict->evict_stage_queues[i].evict_lock);
+        __wt_free(session, evict->evict_stage_queues[i].evict_queue);
+    }
     __wt_free(session, conn->evict);
     return (ret);
 }
@@ -296,6 +296,9 @@ __wt_evict_page_cache_bytes_decr(WT_SESSION_IMPL *session, WT_PAGE *page)
       __wt_atomic_loadsize(&page->memory_footprint), "WT_BTREE.bytes_inmem");
     __wt_cache_decr_check_uint64(session, &cache->bytes_inmem,
       __wt_atomic_loadsize(&page->memory_footprint), "WT_CACHE.bytes_inmem");
+    if (S2C(session)->numa_nodes > 1)
+        __wt_cache_decr_check_uint64(session, &cache->bytes_inmem_node[page->numa_node],
+          __wt_atomic_loadsize(&page->memory_footprint), "WT_CACHE.bytes_inmem_node");
 
     /* Update the bytes_internal value to reflect the eviction */
     if (WT_PAGE_IS_INTERNAL(page)) {
@@ -368,6 +371,33 @@ __wt_evict_clean_pressure(WT_SESSION_IMPL *session)
     return (false);
 }
 
+/*
+ * __wti_evict_bytes_inuse --
+ *     Return the number of bytes in use for the clean eviction trigger and target. If NUMA is
+ *     configured, each node has an equal share of the cache: use the bytes in use on the fullest
+ *     node, scaled up to the whole cache, if that's larger, so a node beyond its share of the cache
+ *     triggers eviction.
+ */
+static WT_INLINE uint64_t
+__wti_evict_bytes_inuse(WT_SESSION_IMPL *session)
+{
+    WT_CACHE *cache;
+    WT_CONNECTION_IMPL *conn;
+    uint64_t bytes_inmem, bytes_node;
+    u_int i;
+
+    conn = S2C(session);
+    cache = conn->cache;
+
+    bytes_inmem = __wt_atomic_load64(&cache->bytes_inmem);
+    for (i = 0; conn->numa_nodes > 1 && i < conn->numa_nodes; ++i) {
+        bytes_node = __wt_atomic_load64(&cache->bytes_inmem_node[i]) * conn->numa_nodes;
+        if (bytes_node > bytes_inmem)
+            bytes_inmem = bytes_node;
+    }
+    return (__wt_cache_bytes_plus_overhead(cache, bytes_inmem));
+}
+
 /* !!!
  * __wt_evict_clean_needed --
  *     Check whether the configured eviction trigger threshold for the total volume of data in the
@@ -392,7 +422,7 @@ __wt_evict_clean_needed(WT_SESSION_IMPL *session, double *pct_fullp)
      * Avoid division by zero if the cache size has not yet been set in a shared cache.
      */
     bytes_max = S2C(session)->cache_size + 1;
-    bytes_inuse = __wt_cache_bytes_inuse(S2C(session)->cache);
+    bytes_inuse = __wti_evict_bytes_inuse(session);
 
     if (pct_fullp != NULL)
         *pct_fullp = ((100.0 * bytes_inuse) / bytes_max);
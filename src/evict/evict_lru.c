@@ -16,6 +16,7 @@ static int __evict_lru_walk(WT_SESSION_IMPL *);
 static int __evict_page(WT_SESSION_IMPL *, bool);
 static int __evict_pass(WT_SESSION_IMPL *);
 static int __evict_server(WT_SESSION_IMPL *, bool *);
+static int __evict_stage_walk(WT_SESSION_IMPL *, WT_THREAD *);
 static void __evict_tune_workers(WT_SESSION_IMPL *session);
 static int __evict_walk(WT_SESSION_IMPL *, WT_EVICT_QUEUE *);
 static int __evict_walk_tree(WT_SESSION_IMPL *, WT_EVICT_QUEUE *, u_int, u_int *);
@@ -155,18 +156,42 @@ __evict_list_clear(WT_SESSION_IMPL *session, WT_EVICT_ENTRY *e)
     e->btree = WT_DEBUG_POINT;
 }
 
+/*
+ * __evict_list_clear_page_queue --
+ *     Search a single eviction queue for the page and clear it if found.
+ */
+static bool
+__evict_list_clear_page_queue(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, WT_REF *ref)
+{
+    WT_EVICT_ENTRY *evict_entry;
+    uint32_t elem, i;
+    bool found;
+
+    found = false;
+    __wt_spin_lock(session, &queue->evict_lock);
+    elem = queue->evict_max;
+    for (i = 0, evict_entry = queue->evict_queue; i < elem; i++, evict_entry++)
+        if (evict_entry->ref == ref) {
+            found = true;
+            __evict_list_clear(session, evict_entry);
+            break;
+        }
+    __wt_spin_unlock(session, &queue->evict_lock);
+    return (found);
+}
+
 /*
  * __evict_list_clear_page_locked --
  *     This function searches for the page in all the eviction queues (skipping the urgent queue if
- *     requested) and clears it if found. It does not take the eviction queue lock, so the caller
- *     should hold the appropriate locks before calling this function.
+ *     requested) and the eviction worker staging queues, and clears it if found. It does not take
+ *     the eviction queue lock, so the caller should hold the appropriate locks before calling this
+ *     function.
  */
 static void
 __evict_list_clear_page_locked(WT_SESSION_IMPL *session, WT_REF *ref, bool exclude_urgent)
 {
     WT_EVICT *evict;
-    WT_EVICT_ENTRY *evict_entry;
-    uint32_t elem, i, q, last_queue_idx;
+    uint32_t q, last_queue_idx;
     bool found;
 
     last_queue_idx = exclude_urgent ? WT_EVICT_URGENT_QUEUE : WT_EVICT_QUEUE_MAX;
@@ -175,17 +200,10 @@ __evict_list_clear_page_locked(WT_SESSION_IMPL *session, WT_REF *ref, bool exclu
 
     WT_ASSERT_SPINLOCK_OWNED(session, &evict->evict_queue_lock);
 
-    for (q = 0; q < last_queue_idx && !found; q++) {
-        __wt_spin_lock(session, &evict->evict_queues[q].evict_lock);
-        elem = evict->evict_queues[q].evict_max;
-        for (i = 0, evict_entry = evict->evict_queues[q].evict_queue; i < elem; i++, evict_entry++)
-            if (evict_entry->ref == ref) {
-                found = true;
-                __evict_list_clear(session, evict_entry);
-                break;
-            }
-        __wt_spin_unlock(session, &evict->evict_queues[q].evict_lock);
-    }
+    for (q = 0; q < last_queue_idx && !found; q++)
+        found = __evict_list_clear_page_queue(session, &evict->evict_queues[q], ref);
+    for (q = 0; q < WT_EVICT_STAGE_QUEUE_MAX && !found; q++)
+        found = __evict_list_clear_page_queue(session, &evict->evict_stage_queues[q], ref);
     WT_ASSERT(session, !F_ISSET_ATOMIC_16(ref->page, WT_PAGE_EVICT_LRU));
 }
 
@@ -312,6 +330,21 @@ __evict_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
     /* Mark the session as an eviction thread session. */
     F_SET(session, WT_SESSION_EVICTION);
 
+    /*
+     * If NUMA is configured, spread the eviction threads across the nodes with CPUs so every node's
+     * pages can be evicted by a thread running on it. A failure to bind isn't fatal, the thread
+     * still prefers pages from its node.
+     */
+    if (conn->numa_nodes > 1 && !session->numa_bound) {
+        session->numa_node = thread->id % conn->numa_nodes;
+        if ((ret = __wt_numa_bind(session, session->numa_node)) != 0)
+            __wt_verbose_info(session, WT_VERB_EVICTION,
+              "eviction thread not bound to NUMA node %u: %s", session->numa_node,
+              __wt_strerror(session, ret, NULL, 0));
+        ret = 0;
+        session->numa_bound = true;
+    }
+
     /*
      * Cache a history store cursor to avoid deadlock: if an eviction thread marks a file busy and
      * then opens a different file (in this case, the HS file), it can deadlock with a thread
@@ -349,8 +382,10 @@ __evict_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
             __wt_cond_auto_wait(session, evict->evict_cond, did_work, NULL);
             __wt_verbose_debug2(session, WT_VERB_EVICTION, "%s", "waking");
         }
-    } else
+    } else {
+        WT_ERR(__evict_stage_walk(session, thread));
         WT_ERR(__evict_lru_pages(session, false));
+    }
 
     if (0) {
 err:
@@ -676,7 +711,7 @@ __evict_update_work(WT_SESSION_IMPL *session)
      * Avoid division by zero if the cache size has not yet been set in a shared cache.
      */
     bytes_max = conn->cache_size + 1;
-    bytes_inuse = __wt_cache_bytes_inuse(cache);
+    bytes_inuse = __wti_evict_bytes_inuse(session);
     if (__wt_evict_clean_needed(session, NULL))
         LF_SET(WT_EVICT_CACHE_CLEAN | WT_EVICT_CACHE_CLEAN_HARD);
     else if (bytes_inuse > (target * bytes_max) / 100)
@@ -878,6 +913,7 @@ __evict_clear_walk(WT_SESSION_IMPL *session, bool clear_pos)
     WT_DECL_RET;
     WT_EVICT *evict;
     WT_REF *ref;
+    WT_SESSION_IMPL *walk_session;
 #define PATH_STR_MAX 1024
     char path_str[PATH_STR_MAX];
     const char *where;
@@ -887,7 +923,9 @@ __evict_clear_walk(WT_SESSION_IMPL *session, bool clear_pos)
     btree = S2BT(session);
     evict = S2C(session)->evict;
 
-    WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_PASS));
+    WT_ASSERT(session,
+      FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_PASS) ||
+        __wt_atomic_load_pointer(&btree->evict_walk_owner) == session);
 
     if ((ref = btree->evict_ref) == NULL)
         return (0);
@@ -941,8 +979,12 @@ __evict_clear_walk(WT_SESSION_IMPL *session, bool clear_pos)
         }
     }
 
-    WT_WITH_DHANDLE(evict->walk_session, session->dhandle,
-      (ret = __wt_page_release(evict->walk_session, ref, WT_READ_NO_EVICT)));
+    /* An eviction worker walking the tree holds the walk point itself. */
+    walk_session = __wt_atomic_load_pointer(&btree->evict_walk_owner) == session ?
+      session :
+      evict->walk_session;
+    WT_WITH_DHANDLE(walk_session, session->dhandle,
+      (ret = __wt_page_release(walk_session, ref, WT_READ_NO_EVICT)));
     return (ret);
 #undef PATH_STR_MAX
 }
@@ -960,8 +1002,10 @@ __evict_clear_all_walks_and_saved_tree(WT_SESSION_IMPL *session)
 
     conn = S2C(session);
 
+    /* Eviction workers clear their own walk point when they finish walking a tree. */
     TAILQ_FOREACH (dhandle, &conn->dhqh, q)
-        if (WT_DHANDLE_BTREE(dhandle))
+        if (WT_DHANDLE_BTREE(dhandle) &&
+          __wt_atomic_load_pointer(&((WT_BTREE *)dhandle->handle)->evict_walk_owner) == NULL)
             WT_WITH_DHANDLE(session, dhandle, WT_TRET(__evict_clear_walk(session, true)));
     __evict_set_saved_walk_tree(session, NULL);
     return (ret);
@@ -1026,6 +1070,13 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
      */
     WT_ERR(__wt_conn_prefetch_clear_tree(session, false));
 
+    /*
+     * Eviction workers claim a tree to walk while holding the walk lock and only if eviction isn't
+     * disabled, wait for any walk already in progress to finish.
+     */
+    while (__wt_atomic_load_pointer(&btree->evict_walk_owner) != NULL)
+        __wt_yield();
+
     /*
      * Ensure no new pages from the file will be queued for eviction after this point, then clear
      * any existing LRU eviction walk for the file.
@@ -1049,6 +1100,15 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
                 __evict_list_clear(session, evict_entry);
         __wt_spin_unlock(session, &evict->evict_queues[q].evict_lock);
     }
+    for (q = 0; q < WT_EVICT_STAGE_QUEUE_MAX; q++) {
+        __wt_spin_lock(session, &evict->evict_stage_queues[q].evict_lock);
+        elem = evict->evict_stage_queues[q].evict_max;
+        for (i = 0, evict_entry = evict->evict_stage_queues[q].evict_queue; i < elem;
+             i++, evict_entry++)
+            if (evict_entry->btree == btree)
+                __evict_list_clear(session, evict_entry);
+        __wt_spin_unlock(session, &evict->evict_stage_queues[q].evict_lock);
+    }
 
     __wt_spin_unlock(session, &evict->evict_queue_lock);
 
@@ -1570,6 +1630,192 @@ __evict_btree_dominating_cache(WT_SESSION_IMPL *session, WT_BTREE *btree)
     return (false);
 }
 
+/*
+ * __evict_walk_claim --
+ *     Claim a tree for an eviction walk: a tree's walk point is only moved by one session at a
+ *     time. The walk lock is held so the claim can't race with a thread disabling eviction.
+ */
+static WT_INLINE bool
+__evict_walk_claim(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+    WT_ASSERT_SPINLOCK_OWNED(session, &S2C(session)->evict->evict_walk_lock);
+
+    return (__wt_atomic_cas_ptr(&btree->evict_walk_owner, NULL, session));
+}
+
+/*
+ * __evict_walk_release --
+ *     Release a tree claimed for an eviction walk.
+ */
+static WT_INLINE void
+__evict_walk_release(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+    WT_ASSERT(session, __wt_atomic_load_pointer(&btree->evict_walk_owner) == session);
+    WT_UNUSED(session);
+
+    WT_RELEASE_WRITE(btree->evict_walk_owner, NULL);
+}
+
+/*
+ * __evict_stage_merge --
+ *     Move the candidates eviction workers have staged into the queue being filled. Candidates that
+ *     don't fit are cleared so a later walk can queue them.
+ */
+static void
+__evict_stage_merge(
+  WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, u_int max_entries, u_int *slotp)
+{
+    WT_EVICT *evict;
+    WT_EVICT_ENTRY *evict_entry, *stage_entry;
+    WT_EVICT_QUEUE *stage;
+    uint64_t merged;
+    uint32_t elem, entries, i, q;
+
+    evict = S2C(session)->evict;
+    merged = 0;
+
+    if (!__wt_atomic_loadbool(&S2C(session)->evict_parallel_walk))
+        return;
+
+    /*
+     * Hold the queue lock: a staged page that's being evicted is searched for in every queue in
+     * turn, it can't be moved between them while the search is running.
+     */
+    __wt_spin_lock(session, &evict->evict_queue_lock);
+    for (q = 0; q < WT_EVICT_STAGE_QUEUE_MAX; q++) {
+        stage = &evict->evict_stage_queues[q];
+
+        /* Workers publish a staging queue once their walk is done. */
+        WT_ACQUIRE_READ(entries, stage->evict_entries);
+        if (entries == 0)
+            continue;
+
+        __wt_spin_lock(session, &stage->evict_lock);
+        elem = stage->evict_max;
+        for (i = 0, stage_entry = stage->evict_queue; i < elem; i++, stage_entry++) {
+            if (stage_entry->ref == NULL)
+                continue;
+            if (*slotp >= max_entries) {
+                __evict_list_clear(session, stage_entry);
+                continue;
+            }
+
+            evict_entry = queue->evict_queue + *slotp;
+            if (evict_entry->ref != NULL)
+                __evict_list_clear(session, evict_entry);
+            *evict_entry = *stage_entry;
+            if (++*slotp > queue->evict_max)
+                queue->evict_max = *slotp;
+            ++merged;
+
+            stage_entry->ref = NULL;
+            stage_entry->btree = WT_DEBUG_POINT;
+        }
+        stage->evict_max = 0;
+        WT_RELEASE_WRITE(stage->evict_entries, 0);
+        __wt_spin_unlock(session, &stage->evict_lock);
+    }
+    __wt_spin_unlock(session, &evict->evict_queue_lock);
+
+    WT_STAT_CONN_INCRV(session, eviction_worker_walk_pages_merged, merged);
+}
+
+/*
+ * __evict_stage_walk --
+ *     An eviction worker with nothing to evict walks a tree the eviction server isn't walking and
+ *     stages the candidates it finds for the server to merge into its queue.
+ */
+static int
+__evict_stage_walk(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_BTREE *btree;
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+    WT_EVICT *evict;
+    WT_EVICT_QUEUE *stage;
+    uint32_t entries;
+    u_int i, slot;
+
+    conn = S2C(session);
+    evict = conn->evict;
+    btree = NULL;
+    dhandle = NULL;
+    slot = 0;
+
+    /* Only walk when there's nothing queued to evict. */
+    if (!__wt_atomic_loadbool(&conn->evict_parallel_walk) ||
+      thread->id >= WT_EVICT_STAGE_QUEUE_MAX || !F_ISSET(evict, WT_EVICT_CACHE_ALL) ||
+      !__evict_queue_empty(evict->evict_current_queue, false))
+        return (0);
+
+    /* Wait for the server to merge the last candidates staged. */
+    stage = &evict->evict_stage_queues[thread->id];
+    WT_ACQUIRE_READ(entries, stage->evict_entries);
+    if (entries != 0 || __wt_atomic_loadv32(&evict->pass_intr) != 0)
+        return (0);
+
+    /*
+     * Pick a tree that has recently been useful to walk, starting from a random point in the handle
+     * list so the workers spread across the trees. Hold a reference so the handle can't be closed
+     * once the list is unlocked.
+     */
+    if (__wt_try_readlock(session, &conn->dhandle_lock) != 0)
+        return (0);
+    if (conn->dhandle_count != 0) {
+        dhandle = TAILQ_FIRST(&conn->dhqh);
+        for (i = __wt_random(&session->rnd) % conn->dhandle_count; i > 0 && dhandle != NULL; i--)
+            dhandle = TAILQ_NEXT(dhandle, q);
+        for (i = 0; i < conn->dhandle_count; i++, dhandle = TAILQ_NEXT(dhandle, q)) {
+            if (dhandle == NULL)
+                dhandle = TAILQ_FIRST(&conn->dhqh);
+            if (!WT_DHANDLE_BTREE(dhandle) || !F_ISSET(dhandle, WT_DHANDLE_OPEN))
+                continue;
+            btree = dhandle->handle;
+            if (btree->evict_disabled == 0 && btree->root.page != NULL &&
+              __wt_atomic_load_pointer(&btree->evict_walk_owner) == NULL &&
+              __wt_atomic_load32(&btree->evict_walk_period) == 0 &&
+              (btree->evict_priority == 0 || __wt_evict_aggressive(session)) &&
+              (!WT_BTREE_SYNCING(btree) ||
+                F_ISSET(evict, WT_EVICT_CACHE_CLEAN | WT_EVICT_CACHE_UPDATES)))
+                break;
+        }
+        if (i == conn->dhandle_count)
+            dhandle = NULL;
+        else
+            (void)__wt_atomic_addi32(&dhandle->session_inuse, 1);
+    }
+    __wt_readunlock(session, &conn->dhandle_lock);
+    if (dhandle == NULL)
+        return (0);
+
+    /*
+     * Claim the tree under the walk lock, then walk it without the lock: a thread turning off
+     * eviction for the tree waits for the claim to be released. Check that eviction is still
+     * running after the claim, the last eviction thread to stop clears the walks of unclaimed
+     * trees.
+     */
+    if (__wt_spin_trylock(session, &evict->evict_walk_lock) == 0) {
+        if (btree->evict_disabled == 0 && btree->root.page != NULL &&
+          __evict_walk_claim(session, btree)) {
+            __wt_spin_unlock(session, &evict->evict_walk_lock);
+            if (F_ISSET(conn, WT_CONN_EVICTION_RUN)) {
+                WT_WITH_DHANDLE(session, dhandle,
+                  ret = __evict_walk_tree(session, stage, WT_EVICT_WALK_INCR, &slot));
+                WT_ASSERT(session, __wt_session_gen(session, WT_GEN_SPLIT) == 0);
+                WT_STAT_CONN_INCR(session, eviction_worker_walk);
+            }
+            __evict_walk_release(session, btree);
+        } else
+            __wt_spin_unlock(session, &evict->evict_walk_lock);
+    }
+    (void)__wt_atomic_subi32(&dhandle->session_inuse, 1);
+
+    /* Publish the candidates. */
+    WT_RELEASE_WRITE(stage->evict_entries, slot);
+    return (ret);
+}
+
 /*
  * __evict_walk --
  *     Fill in the array by walking the next set of pages.
@@ -1614,6 +1860,9 @@ __evict_walk(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue)
         __wt_atomic_load64(&cache->pages_dirty_leaf));
     max_entries = WT_MIN(max_entries, 1 + total_candidates / 2);
 
+    /* Start with the candidates eviction workers found. */
+    __evict_stage_merge(session, queue, max_entries, &slot);
+
 retry:
     loop_count = 0;
     while (slot < max_entries && loop_count++ < conn->dhandle_count) {
@@ -1713,10 +1962,15 @@ retry:
          */
         if (btree->evict_disabled == 0 && !__wt_spin_trylock(session, &evict->evict_walk_lock)) {
             if (btree->evict_disabled == 0 && btree->root.page != NULL) {
-                WT_WITH_DHANDLE(
-                  session, dhandle, ret = __evict_walk_tree(session, queue, max_entries, &slot));
-
-                WT_ASSERT(session, __wt_session_gen(session, WT_GEN_SPLIT) == 0);
+                /* Skip trees an eviction worker is walking. */
+                if (__evict_walk_claim(session, btree)) {
+                    WT_WITH_DHANDLE(session, dhandle,
+                      ret = __evict_walk_tree(session, queue, max_entries, &slot));
+                    __evict_walk_release(session, btree);
+
+                    WT_ASSERT(session, __wt_session_gen(session, WT_GEN_SPLIT) == 0);
+                } else
+                    WT_STAT_CONN_INCR(session, eviction_server_skip_trees_worker_walk);
             }
             __wt_spin_unlock(session, &evict->evict_walk_lock);
             WT_ERR(ret);
@@ -2344,7 +2598,7 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, u_int max_ent
     give_up = urgent_queued = false;
     txn = session->txn;
 
-    WT_ASSERT_SPINLOCK_OWNED(session, &evict->evict_walk_lock);
+    WT_ASSERT(session, __wt_atomic_load_pointer(&btree->evict_walk_owner) == session);
 
     start = queue->evict_queue + *slotp;
     target_pages = __evict_get_target_pages(session, max_entries, *slotp);
@@ -2486,7 +2740,7 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, u_int max_ent
           __wt_atomic_loadsize(&ref->page->memory_footprint) >= btree->splitmempage) {
             if (restarts == 0)
                 WT_STAT_CONN_INCR(session, eviction_walks_abandoned);
-            WT_RET(__wt_page_release(evict->walk_session, ref, walk_flags));
+            WT_RET(__wt_page_release(session, ref, walk_flags));
             ref = NULL;
         } else {
             while (ref != NULL &&
@@ -2509,6 +2763,45 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, u_int max_ent
     return (0);
 }
 
+/*
+ * __evict_numa_local --
+ *     Take a page created on the thread's NUMA node, if one is queued close to the head of the
+ *     queue. The other entries aren't reordered, the taken entry is cleared and the walk of the
+ *     queue skips it.
+ */
+static bool
+__evict_numa_local(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, uint32_t candidates,
+  bool dirty_ok, WT_BTREE **btreep, WT_REF **refp, WT_REF_STATE *previous_statep)
+{
+    WT_EVICT_ENTRY *end, *evict_entry;
+    WT_PAGE *page;
+    WT_REF_STATE previous_state;
+    u_int i;
+
+    if ((evict_entry = queue->evict_current) == NULL)
+        return (false);
+    end = queue->evict_queue + candidates;
+    for (i = 0; evict_entry < end && i < WT_EVICT_NUMA_LOOKAHEAD; ++evict_entry, ++i) {
+        if (evict_entry->ref == NULL || (page = evict_entry->ref->page) == NULL ||
+          page->numa_node != session->numa_node || (!dirty_ok && __wt_page_is_modified(page)))
+            continue;
+
+        /* Lock the page as the walk of the queue does, a page that's already locked is skipped. */
+        if ((previous_state = WT_REF_GET_STATE(evict_entry->ref)) != WT_REF_MEM ||
+          !WT_REF_CAS_STATE(session, evict_entry->ref, previous_state, WT_REF_LOCKED))
+            continue;
+        (void)__wt_atomic_addv32(&evict_entry->btree->evict_busy, 1);
+
+        *btreep = evict_entry->btree;
+        *refp = evict_entry->ref;
+        *previous_statep = previous_state;
+        __evict_list_clear(session, evict_entry);
+        WT_STAT_CONN_INCR(session, eviction_worker_numa_local);
+        return (true);
+    }
+    return (false);
+}
+
 /*
  * __evict_get_ref --
  *     Get a page for eviction.
@@ -2517,12 +2810,14 @@ static int
 __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_REF **refp,
   WT_REF_STATE *previous_statep)
 {
+    WT_CACHE *cache;
+    WT_CONNECTION_IMPL *conn;
     WT_EVICT *evict;
     WT_EVICT_ENTRY *evict_entry;
     WT_EVICT_QUEUE *queue, *other_queue, *urgent_queue;
     WT_REF_STATE previous_state;
     uint32_t candidates;
-    bool is_app, server_only, urgent_ok;
+    bool dirty_ok, is_app, numa_local, server_only, urgent_ok;
 
     *btreep = NULL;
     /*
@@ -2532,7 +2827,9 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
     *previous_statep = WT_REF_MEM;
     *refp = NULL;
 
-    evict = S2C(session)->evict;
+    conn = S2C(session);
+    cache = conn->cache;
+    evict = conn->evict;
     is_app = !F_ISSET(session, WT_SESSION_INTERNAL);
     server_only = is_server && !WT_EVICT_HAS_WORKERS(session);
     /* Application threads do eviction when cache is full of dirty data */
@@ -2611,6 +2908,31 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
     if (is_server && queue != urgent_queue && candidates > 1)
         candidates /= 2;
 
+    /*
+     * Evicting a dirty page in the server thread could stall during a write and prevent eviction
+     * from finding new work.
+     *
+     * However, we can't skip entries in the urgent queue or they may never be found again.
+     *
+     * Don't force application threads to evict dirty pages if they aren't stalled by the amount of
+     * dirty data in cache.
+     */
+    dirty_ok = urgent_ok ||
+      (!is_server && F_ISSET(evict, WT_EVICT_CACHE_DIRTY_HARD | WT_EVICT_CACHE_UPDATES_HARD));
+
+    /*
+     * Threads bound to a NUMA node prefer the node's pages, as long as the node holds at least its
+     * share of the cache: otherwise it's the other nodes that need eviction.
+     */
+    numa_local = session->numa_bound && queue != urgent_queue &&
+      __wt_atomic_load64(&cache->bytes_inmem_node[session->numa_node]) * conn->numa_nodes >=
+        __wt_atomic_load64(&cache->bytes_inmem);
+    if (numa_local &&
+      __evict_numa_local(session, queue, candidates, dirty_ok, btreep, refp, previous_statep)) {
+        __wt_spin_unlock(session, &queue->evict_lock);
+        return (0);
+    }
+
     /* Get the next page queued for eviction. */
     for (evict_entry = queue->evict_current;
          evict_entry >= queue->evict_queue && evict_entry < queue->evict_queue + candidates;
@@ -2619,18 +2941,8 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
             continue;
         WT_ASSERT(session, evict_entry->btree != NULL);
 
-        /*
-         * Evicting a dirty page in the server thread could stall during a write and prevent
-         * eviction from finding new work.
-         *
-         * However, we can't skip entries in the urgent queue or they may never be found again.
-         *
-         * Don't force application threads to evict dirty pages if they aren't stalled by the amount
-         * of dirty data in cache.
-         */
-        if (!urgent_ok &&
-          (is_server || !F_ISSET(evict, WT_EVICT_CACHE_DIRTY_HARD | WT_EVICT_CACHE_UPDATES_HARD)) &&
-          __wt_page_is_modified(evict_entry->ref->page)) {
+        /* Stop at a dirty page if we can't evict it. */
+        if (!dirty_ok && __wt_page_is_modified(evict_entry->ref->page)) {
             --evict_entry;
             break;
         }
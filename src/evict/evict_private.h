@@ -15,6 +15,8 @@
 #define WT_EVICT_WALK_BASE 300 /* Pages tracked across file visits */
 #define WT_EVICT_WALK_INCR 100 /* Pages added each walk */
 
+#define WT_EVICT_NUMA_LOOKAHEAD 16 /* Queue entries searched for a NUMA-local page */
+
 /*
  * WT_EVICT_ENTRY --
  *	Encapsulation of an eviction candidate.
@@ -28,6 +30,12 @@ struct __wt_evict_entry {
 #define WT_EVICT_QUEUE_MAX 3    /* Two ordinary queues plus urgent */
 #define WT_EVICT_URGENT_QUEUE 2 /* Urgent queue index */
 
+/*
+ * Eviction workers walking trees in parallel with the eviction server stage their candidates in a
+ * queue per thread, there can be as many as the maximum configurable eviction threads.
+ */
+#define WT_EVICT_STAGE_QUEUE_MAX 20
+
 /*
  * WT_EVICT_QUEUE --
  *	Encapsulation of an eviction candidate queue.
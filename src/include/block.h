@@ -113,6 +113,21 @@ typedef struct {
 
     WT_SIZE *sz_cache;  /* List of WT_SIZE handles */
     u_int sz_cache_cnt; /* Count */
+
+#define WT_BLOCK_READ_ASYNC_MAX 32
+    WT_IO_REQ *io_req;    /* Asynchronous reads not yet consumed */
+    u_int *io_req_blocks; /* Blocks in each read not yet consumed */
+    u_int io_req_cnt;     /* Count */
+
+    /*
+     * Physically adjacent blocks are coalesced into a single read, held here until a block that
+     * doesn't extend it is requested or a block is consumed.
+     */
+#define WT_BLOCK_READ_COALESCE_MAX (1024 * 1024)
+    WT_FH *io_pend_fh;       /* File handle */
+    wt_off_t io_pend_offset; /* Read offset */
+    size_t io_pend_len;      /* Read length */
+    u_int io_pend_blocks;    /* Blocks in the read */
 } WT_BLOCK_MGR_SESSION;
 
 /*
@@ -214,6 +229,7 @@ struct __wt_bm {
     bool (*is_mapped)(WT_BM *, WT_SESSION_IMPL *);
     int (*map_discard)(WT_BM *, WT_SESSION_IMPL *, void *, size_t);
     int (*read)(WT_BM *, WT_SESSION_IMPL *, WT_ITEM *, const uint8_t *, size_t);
+    int (*read_async)(WT_BM *, WT_SESSION_IMPL *, const uint8_t *, size_t);
     int (*salvage_end)(WT_BM *, WT_SESSION_IMPL *);
     int (*salvage_next)(WT_BM *, WT_SESSION_IMPL *, uint8_t *, size_t *, bool *);
     int (*salvage_start)(WT_BM *, WT_SESSION_IMPL *);
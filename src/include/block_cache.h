@@ -30,9 +30,14 @@
 /* How often we compute the total size of the files open in the block manager. */
 #define WT_BLKCACHE_FILESIZE_EST_FREQ (5 * WT_THOUSAND)
 
-#define WT_BLKCACHE_MINREF_INCREMENT 20      /* Eviction references window */
-#define WT_BLKCACHE_EVICT_OTHER 0            /* Not evicting for various reasons */
-#define WT_BLKCACHE_NOT_EVICTION_CANDIDATE 1 /* Not evicting because of frequency counter */
+/*
+ * The maximum CLOCK usage count of a block: a block referenced this many times survives this many
+ * sweeps of the eviction clock without another reference.
+ */
+#define WT_BLKCACHE_CLOCK_MAX 3
+
+/* The most blocks evicted from a bucket each time the eviction clock visits it. */
+#define WT_BLKCACHE_EVICT_BUCKET_MAX 32
 
 /* Block access operations. */
 #define WT_BLKCACHE_RM_EXIT 1
@@ -44,21 +49,26 @@
  *     Block cache item. It links with other items in the same hash bucket.
  */
 struct __wt_blkcache_item {
-    TAILQ_ENTRY(__wt_blkcache_item) hashq;
+    /*
+     * Lookups walk the hash chains without a lock: a block is linked into and out of its chain
+     * under the bucket lock, and its memory isn't freed until lookups that could have seen it have
+     * finished (see WT_GEN_BLKCACHE).
+     */
+    WT_BLKCACHE_ITEM *volatile next;
 
     void *data;
     uint32_t data_size;
     uint32_t num_references;
 
     /*
-     * This counter is incremented every time a block is referenced and decremented every time the
-     * eviction thread sweeps through the cache. This counter will be low for blocks that have not
-     * been reused or for blocks that were reused in the past but lost their appeal. In this sense,
-     * this counter is a metric combining frequency and recency, and hence its name.
+     * The CLOCK usage count: set on every reference and decremented every time the eviction clock
+     * sweeps past the block, a block is evicted when the clock finds it at zero. Updated without
+     * synchronization, a lost update only changes the order in which blocks are evicted.
      */
-    wt_shared int32_t freq_rec_counter;
+    wt_shared uint8_t clock_count;
 
-    wt_shared uint32_t ref_count; /* References */
+    wt_shared volatile bool removed; /* Block is being removed from the cache */
+    wt_shared uint32_t ref_count;    /* References */
 
     uint32_t fid;      /* File ID */
     uint8_t addr_size; /* Address cookie */
@@ -71,13 +81,18 @@ struct __wt_blkcache_item {
  * and the total amount of space they occupy.
  */
 struct __wt_blkcache {
-    /* Locked: Block manager cache. Locks are per-bucket. */
-    TAILQ_HEAD(__wt_blkcache_hash, __wt_blkcache_item) * hash;
+    /*
+     * Block manager cache hash chains. Lookups are lock-free, inserts and removals are locked by
+     * per-bucket locks.
+     */
+    WT_BLKCACHE_ITEM *volatile *hash;
     WT_SPINLOCK *hash_locks;
 
+    WT_SESSION_IMPL *evict_session; /* Eviction thread session */
     wt_thread_t evict_thread_tid;
+    WT_CONDVAR *evict_cond;                   /* Eviction thread wait mutex */
     wt_shared volatile bool blkcache_exiting; /* If destroying the cache */
-    int32_t evict_aggressive;                 /* Seconds an unused block stays in the cache */
+    u_int evict_clock_hand;                   /* Bucket where the eviction clock stopped */
 
     bool cache_on_checkpoint; /* Don't cache blocks written by checkpoints */
     bool cache_on_writes;     /* Cache blocks on writes */
@@ -111,8 +126,6 @@ struct __wt_blkcache {
     uint64_t max_bytes;            /* Block cache size */
     uint64_t system_ram;           /* Configured size of system RAM */
 
-    uint32_t min_num_references; /* The per-block number of references triggering eviction. */
-
     /*
      * Various metrics helping us measure the overhead and decide if to bypass the cache. We access
      * some of them without synchronization despite races. These serve as heuristics, and we don't
@@ -515,6 +515,24 @@ WT_PACKED_STRUCT_BEGIN(__wt_col_rle)
     uint32_t indx;  /* Slot of entry in col_var. */
 WT_PACKED_STRUCT_END
 
+/*
+ * WT_ROW_SRCH_INDEX --
+ *	A row-store leaf page's search index: the key prefix common to every key
+ * on the page and, for each slot, the next 8 bytes of the key as a big-endian
+ * integer (zero-padded if the key is shorter). Comparing those integers is a
+ * cheap first step in a search, it narrows the slots to the ones with a key
+ * that could match and only those keys are built and compared. The index is
+ * built the first time the page is searched.
+ */
+struct __wt_row_srch_index {
+#define WT_ROW_SRCH_INDEX_MIN 32  /* Minimum page entries to build an index */
+#define WT_ROW_SRCH_PREFIX_MAX 56 /* Maximum common key prefix */
+    uint32_t prefix_len;
+    uint8_t prefix[WT_ROW_SRCH_PREFIX_MAX];
+
+    uint64_t *keys;
+};
+
 /*
  * WT_PAGE_INDEX --
  *	The page index held by each internal page.
@@ -689,9 +707,14 @@ struct __wt_page {
     while (0)
 
         /* Row-store leaf page. */
-        WT_ROW *row; /* Key/value pairs */
+        struct {
+            WT_ROW *row;                   /* Key/value pairs */
+            WT_ROW_SRCH_INDEX *srch_index; /* Search index */
+        } row;
 #undef pg_row
-#define pg_row u.row
+#define pg_row u.row.row
+#undef pg_row_srch_index
+#define pg_row_srch_index u.row.srch_index
 
         /* Fixed-length column-store leaf page. */
         struct {
@@ -743,7 +766,8 @@ struct __wt_page {
 #define WT_PAGE_INTL_OVERFLOW_KEYS 0x080u /* Internal page has overflow keys (historic only) */
 #define WT_PAGE_PREFETCH 0x100u           /* The page is being pre-fetched */
 #define WT_PAGE_SPLIT_INSERT 0x200u       /* A leaf page was split for append */
-#define WT_PAGE_UPDATE_IGNORE 0x400u      /* Ignore updates on page discard */
+#define WT_PAGE_SRCH_INDEX_SKIP 0x400u    /* Leaf page can't have a search index */
+#define WT_PAGE_UPDATE_IGNORE 0x800u      /* Ignore updates on page discard */
                                           /* AUTOMATIC FLAG VALUE GENERATION STOP 16 */
     wt_shared uint16_t flags_atomic;      /* Atomic flags, use F_*_ATOMIC_16 */
 
@@ -759,7 +783,7 @@ struct __wt_page {
 #define WT_PAGE_ROW_LEAF 7      /* Row-store leaf page */
     uint8_t type;               /* Page type */
 
-    /* 1 byte hole expected. */
+    uint8_t numa_node; /* NUMA node where the page was created */
 
     wt_shared size_t memory_footprint; /* Memory attached to the page */
 
@@ -276,6 +276,7 @@ struct __wt_btree {
     wt_shared volatile uint32_t evict_busy;    /* Count of threads in eviction */
     wt_shared volatile uint32_t prefetch_busy; /* Count of threads in prefetch */
     WT_EVICT_WALK_TYPE evict_start_type;
+    wt_shared WT_SESSION_IMPL *evict_walk_owner; /* Session walking the tree for eviction */
 
 /*
  * Flag values up to 0xfff are reserved for WT_DHANDLE_XXX. See comment with dhandle flags for an
@@ -292,6 +292,8 @@ __wt_cache_page_inmem_incr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
      */
     (void)__wt_atomic_add64(&cache->bytes_inmem, size);
     (void)__wt_atomic_add64(&btree->bytes_inmem, size);
+    if (S2C(session)->numa_nodes > 1)
+        (void)__wt_atomic_add64(&cache->bytes_inmem_node[page->numa_node], size);
     if (WT_PAGE_IS_INTERNAL(page)) {
         (void)__wt_atomic_add64(&cache->bytes_internal, size);
         (void)__wt_atomic_add64(&btree->bytes_internal, size);
@@ -492,6 +494,9 @@ __wt_cache_page_inmem_decr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
     __wt_cache_decr_check_size(session, &page->memory_footprint, size, "WT_PAGE.memory_footprint");
     __wt_cache_decr_check_uint64(session, &btree->bytes_inmem, size, "WT_BTREE.bytes_inmem");
     __wt_cache_decr_check_uint64(session, &cache->bytes_inmem, size, "WT_CACHE.bytes_inmem");
+    if (S2C(session)->numa_nodes > 1)
+        __wt_cache_decr_check_uint64(
+          session, &cache->bytes_inmem_node[page->numa_node], size, "WT_CACHE.bytes_inmem_node");
     if (page->modify != NULL && !WT_PAGE_IS_INTERNAL(page) && !btree->lsm_primary)
         __wt_cache_page_byte_updates_decr(session, page, size);
     if (__wt_page_is_modified(page))
@@ -1206,6 +1211,27 @@ __wt_row_leaf_key_free(WT_SESSION_IMPL *session, WT_PAGE *page, WT_ROW *rip)
     __wt_free(session, ikey);
 }
 
+/*
+ * __wt_row_srch_index_key --
+ *     Return the search index value of a key: the 8 bytes following the page's common prefix as a
+ *     big-endian integer, zero-padded if the key is shorter.
+ */
+static WT_INLINE uint64_t
+__wt_row_srch_index_key(const uint8_t *key, size_t key_size, size_t prefix_len)
+{
+    uint64_t v;
+    size_t i;
+
+    /*
+     * The padding keeps the integers in the same order as the keys: a key shorter than another key
+     * and matching it to its length sorts first, and it compares less than or equal to the longer
+     * key here. Equal values don't imply equal keys, which is why the index only narrows a search.
+     */
+    for (v = 0, i = prefix_len; i < prefix_len + 8; ++i)
+        v = (v << 8) | (i < key_size ? key[i] : 0);
+    return (v);
+}
+
 /*
  * __wt_row_leaf_key --
  *     Set a buffer to reference a row-store leaf page key as cheaply as possible.
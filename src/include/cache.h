@@ -18,6 +18,10 @@ typedef enum __wt_cache_op {
 
 #define WT_HS_FILE_MIN (100 * WT_MEGABYTE)
 
+/* The NUMA topology we can track, a page's node is stored in a byte. */
+#define WT_NUMA_CPUS_MAX 1024
+#define WT_NUMA_NODES_MAX 8
+
 /*
  * WiredTiger cache structure.
  */
@@ -41,6 +45,9 @@ struct __wt_cache {
     wt_shared uint64_t bytes_updates;    /* Bytes of updates to pages */
     wt_shared uint64_t bytes_written;
 
+    /* Bytes in memory per NUMA node, maintained if NUMA is configured. */
+    wt_shared uint64_t bytes_inmem_node[WT_NUMA_NODES_MAX];
+
     /*
      * History store cache usage. TODO: The values for these variables are cached and potentially
      * outdated.
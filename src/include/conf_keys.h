@@ -18,45 +18,47 @@
 #define WT_CONF_ID_Assert 1ULL
 #define WT_CONF_ID_Block_cache 178ULL
 #define WT_CONF_ID_Checkpoint 193ULL
-#define WT_CONF_ID_Checkpoint_cleanup 196ULL
-#define WT_CONF_ID_Chunk_cache 198ULL
-#define WT_CONF_ID_Compatibility 200ULL
+#define WT_CONF_ID_Checkpoint_cleanup 197ULL
+#define WT_CONF_ID_Chunk_cache 199ULL
+#define WT_CONF_ID_Compatibility 201ULL
 #define WT_CONF_ID_Debug 123ULL
-#define WT_CONF_ID_Debug_mode 202ULL
+#define WT_CONF_ID_Debug_mode 203ULL
 #define WT_CONF_ID_Encryption 19ULL
-#define WT_CONF_ID_Eviction 221ULL
-#define WT_CONF_ID_File_manager 233ULL
+#define WT_CONF_ID_Eviction 222ULL
+#define WT_CONF_ID_File_manager 235ULL
 #define WT_CONF_ID_Flush_tier 167ULL
-#define WT_CONF_ID_Hash 297ULL
-#define WT_CONF_ID_Heuristic_controls 238ULL
-#define WT_CONF_ID_History_store 242ULL
+#define WT_CONF_ID_Hash 298ULL
+#define WT_CONF_ID_Heuristic_controls 240ULL
+#define WT_CONF_ID_History_store 244ULL
 #define WT_CONF_ID_Import 104ULL
 #define WT_CONF_ID_Incremental 128ULL
-#define WT_CONF_ID_Io_capacity 244ULL
+#define WT_CONF_ID_Io_capacity 246ULL
+#define WT_CONF_ID_Io_uring 303ULL
 #define WT_CONF_ID_Log 36ULL
 #define WT_CONF_ID_Lsm 68ULL
-#define WT_CONF_ID_Lsm_manager 254ULL
+#define WT_CONF_ID_Lsm_manager 256ULL
 #define WT_CONF_ID_Merge_custom 78ULL
-#define WT_CONF_ID_Operation_tracking 257ULL
-#define WT_CONF_ID_Prefetch 277ULL
+#define WT_CONF_ID_Numa 312ULL
+#define WT_CONF_ID_Operation_tracking 259ULL
+#define WT_CONF_ID_Prefetch 279ULL
 #define WT_CONF_ID_Roundup_timestamps 161ULL
-#define WT_CONF_ID_Shared_cache 259ULL
-#define WT_CONF_ID_Statistics_log 263ULL
+#define WT_CONF_ID_Shared_cache 261ULL
+#define WT_CONF_ID_Statistics_log 265ULL
 #define WT_CONF_ID_Tiered_storage 47ULL
-#define WT_CONF_ID_Transaction_sync 315ULL
+#define WT_CONF_ID_Transaction_sync 321ULL
 #define WT_CONF_ID_access_pattern_hint 12ULL
 #define WT_CONF_ID_action 93ULL
 #define WT_CONF_ID_allocation_size 13ULL
 #define WT_CONF_ID_app_metadata 0ULL
 #define WT_CONF_ID_append 90ULL
-#define WT_CONF_ID_archive 248ULL
+#define WT_CONF_ID_archive 250ULL
 #define WT_CONF_ID_auth_token 48ULL
 #define WT_CONF_ID_auto_throttle 69ULL
-#define WT_CONF_ID_available 308ULL
+#define WT_CONF_ID_available 314ULL
 #define WT_CONF_ID_background 97ULL
-#define WT_CONF_ID_background_compact 203ULL
+#define WT_CONF_ID_background_compact 204ULL
 #define WT_CONF_ID_backup 171ULL
-#define WT_CONF_ID_backup_restore_target 280ULL
+#define WT_CONF_ID_backup_restore_target 281ULL
 #define WT_CONF_ID_blkcache_eviction_aggression 181ULL
 #define WT_CONF_ID_block_allocation 14ULL
 #define WT_CONF_ID_block_compressor 15ULL
@@ -69,12 +71,12 @@
 #define WT_CONF_ID_bound 94ULL
 #define WT_CONF_ID_bucket 49ULL
 #define WT_CONF_ID_bucket_prefix 50ULL
-#define WT_CONF_ID_buckets 298ULL
-#define WT_CONF_ID_buffer_alignment 281ULL
-#define WT_CONF_ID_builtin_extension_config 282ULL
+#define WT_CONF_ID_buckets 299ULL
+#define WT_CONF_ID_buffer_alignment 282ULL
+#define WT_CONF_ID_builtin_extension_config 283ULL
 #define WT_CONF_ID_bulk 121ULL
 #define WT_CONF_ID_cache 172ULL
-#define WT_CONF_ID_cache_cursors 273ULL
+#define WT_CONF_ID_cache_cursors 275ULL
 #define WT_CONF_ID_cache_directory 51ULL
 #define WT_CONF_ID_cache_max_wait_ms 189ULL
 #define WT_CONF_ID_cache_on_checkpoint 179ULL
@@ -83,51 +85,51 @@
 #define WT_CONF_ID_cache_resident 16ULL
 #define WT_CONF_ID_cache_size 191ULL
 #define WT_CONF_ID_cache_stuck_timeout_ms 192ULL
-#define WT_CONF_ID_capacity 284ULL
+#define WT_CONF_ID_capacity 285ULL
 #define WT_CONF_ID_checkpoint 56ULL
 #define WT_CONF_ID_checkpoint_backup_info 57ULL
 #define WT_CONF_ID_checkpoint_cleanup 165ULL
-#define WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max 239ULL
-#define WT_CONF_ID_checkpoint_fail_before_turtle_update 274ULL
+#define WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max 241ULL
+#define WT_CONF_ID_checkpoint_fail_before_turtle_update 276ULL
 #define WT_CONF_ID_checkpoint_lsn 58ULL
 #define WT_CONF_ID_checkpoint_read_timestamp 124ULL
-#define WT_CONF_ID_checkpoint_retention 205ULL
-#define WT_CONF_ID_checkpoint_sync 283ULL
+#define WT_CONF_ID_checkpoint_retention 206ULL
+#define WT_CONF_ID_checkpoint_sync 284ULL
 #define WT_CONF_ID_checkpoint_use_history 122ULL
 #define WT_CONF_ID_checkpoint_wait 110ULL
 #define WT_CONF_ID_checksum 17ULL
-#define WT_CONF_ID_chunk 260ULL
-#define WT_CONF_ID_chunk_cache 246ULL
-#define WT_CONF_ID_chunk_cache_evict_trigger 285ULL
+#define WT_CONF_ID_chunk 262ULL
+#define WT_CONF_ID_chunk_cache 248ULL
+#define WT_CONF_ID_chunk_cache_evict_trigger 286ULL
 #define WT_CONF_ID_chunk_count_limit 75ULL
 #define WT_CONF_ID_chunk_max 76ULL
 #define WT_CONF_ID_chunk_size 77ULL
 #define WT_CONF_ID_chunks 66ULL
-#define WT_CONF_ID_close_handle_minimum 234ULL
-#define WT_CONF_ID_close_idle_time 235ULL
-#define WT_CONF_ID_close_scan_interval 236ULL
+#define WT_CONF_ID_close_handle_minimum 236ULL
+#define WT_CONF_ID_close_idle_time 237ULL
+#define WT_CONF_ID_close_scan_interval 238ULL
 #define WT_CONF_ID_colgroups 87ULL
 #define WT_CONF_ID_collator 6ULL
 #define WT_CONF_ID_columns 7ULL
 #define WT_CONF_ID_commit_timestamp 2ULL
 #define WT_CONF_ID_compare 116ULL
 #define WT_CONF_ID_compare_timestamp 105ULL
-#define WT_CONF_ID_compile_configuration_count 290ULL
-#define WT_CONF_ID_compressor 302ULL
-#define WT_CONF_ID_config 269ULL
-#define WT_CONF_ID_config_base 291ULL
-#define WT_CONF_ID_configuration 206ULL
+#define WT_CONF_ID_compile_configuration_count 291ULL
+#define WT_CONF_ID_compressor 305ULL
+#define WT_CONF_ID_config 271ULL
+#define WT_CONF_ID_config_base 292ULL
+#define WT_CONF_ID_configuration 207ULL
 #define WT_CONF_ID_consolidate 129ULL
-#define WT_CONF_ID_corruption_abort 204ULL
+#define WT_CONF_ID_corruption_abort 205ULL
 #define WT_CONF_ID_count 117ULL
-#define WT_CONF_ID_create 292ULL
-#define WT_CONF_ID_cursor_copy 207ULL
-#define WT_CONF_ID_cursor_reposition 208ULL
+#define WT_CONF_ID_create 293ULL
+#define WT_CONF_ID_cursor_copy 208ULL
+#define WT_CONF_ID_cursor_reposition 209ULL
 #define WT_CONF_ID_cursors 173ULL
-#define WT_CONF_ID_default 309ULL
-#define WT_CONF_ID_dhandle_buckets 299ULL
+#define WT_CONF_ID_default 315ULL
+#define WT_CONF_ID_dhandle_buckets 300ULL
 #define WT_CONF_ID_dictionary 18ULL
-#define WT_CONF_ID_direct_io 293ULL
+#define WT_CONF_ID_direct_io 294ULL
 #define WT_CONF_ID_do_not_clear_txn_id 144ULL
 #define WT_CONF_ID_drop 166ULL
 #define WT_CONF_ID_dryrun 98ULL
@@ -142,65 +144,65 @@
 #define WT_CONF_ID_dump_tree_shape 152ULL
 #define WT_CONF_ID_dump_version 125ULL
 #define WT_CONF_ID_durable_timestamp 3ULL
-#define WT_CONF_ID_early_load 270ULL
+#define WT_CONF_ID_early_load 272ULL
 #define WT_CONF_ID_enabled 37ULL
-#define WT_CONF_ID_entry 271ULL
-#define WT_CONF_ID_error_prefix 220ULL
-#define WT_CONF_ID_evict_sample_inmem 224ULL
-#define WT_CONF_ID_eviction 209ULL
-#define WT_CONF_ID_eviction_checkpoint_target 225ULL
-#define WT_CONF_ID_eviction_checkpoint_ts_ordering 219ULL
-#define WT_CONF_ID_eviction_dirty_target 226ULL
-#define WT_CONF_ID_eviction_dirty_trigger 227ULL
-#define WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max 240ULL
-#define WT_CONF_ID_eviction_target 228ULL
-#define WT_CONF_ID_eviction_trigger 229ULL
-#define WT_CONF_ID_eviction_updates_target 230ULL
-#define WT_CONF_ID_eviction_updates_trigger 231ULL
+#define WT_CONF_ID_entry 273ULL
+#define WT_CONF_ID_error_prefix 221ULL
+#define WT_CONF_ID_evict_sample_inmem 225ULL
+#define WT_CONF_ID_eviction 210ULL
+#define WT_CONF_ID_eviction_checkpoint_target 227ULL
+#define WT_CONF_ID_eviction_checkpoint_ts_ordering 220ULL
+#define WT_CONF_ID_eviction_dirty_target 228ULL
+#define WT_CONF_ID_eviction_dirty_trigger 229ULL
+#define WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max 242ULL
+#define WT_CONF_ID_eviction_target 230ULL
+#define WT_CONF_ID_eviction_trigger 231ULL
+#define WT_CONF_ID_eviction_updates_target 232ULL
+#define WT_CONF_ID_eviction_updates_trigger 233ULL
 #define WT_CONF_ID_exclude 99ULL
 #define WT_CONF_ID_exclusive 103ULL
 #define WT_CONF_ID_exclusive_refreshed 96ULL
-#define WT_CONF_ID_extensions 295ULL
-#define WT_CONF_ID_extra_diagnostics 232ULL
+#define WT_CONF_ID_extensions 296ULL
+#define WT_CONF_ID_extra_diagnostics 234ULL
 #define WT_CONF_ID_extractor 63ULL
 #define WT_CONF_ID_file 130ULL
-#define WT_CONF_ID_file_extend 296ULL
-#define WT_CONF_ID_file_max 243ULL
+#define WT_CONF_ID_file_extend 297ULL
+#define WT_CONF_ID_file_max 245ULL
 #define WT_CONF_ID_file_metadata 106ULL
 #define WT_CONF_ID_final_flush 169ULL
 #define WT_CONF_ID_flush_time 85ULL
 #define WT_CONF_ID_flush_timestamp 86ULL
-#define WT_CONF_ID_flushed_data_cache_insertion 287ULL
+#define WT_CONF_ID_flushed_data_cache_insertion 288ULL
 #define WT_CONF_ID_force 111ULL
 #define WT_CONF_ID_force_stop 131ULL
-#define WT_CONF_ID_force_write_wait 303ULL
+#define WT_CONF_ID_force_write_wait 306ULL
 #define WT_CONF_ID_format 22ULL
 #define WT_CONF_ID_free_space_target 100ULL
 #define WT_CONF_ID_full_target 182ULL
-#define WT_CONF_ID_generation_drain_timeout_ms 237ULL
+#define WT_CONF_ID_generation_drain_timeout_ms 239ULL
 #define WT_CONF_ID_get 143ULL
 #define WT_CONF_ID_granularity 132ULL
 #define WT_CONF_ID_handles 174ULL
 #define WT_CONF_ID_hashsize 184ULL
-#define WT_CONF_ID_hazard_max 300ULL
+#define WT_CONF_ID_hazard_max 301ULL
 #define WT_CONF_ID_huffman_key 23ULL
 #define WT_CONF_ID_huffman_value 24ULL
 #define WT_CONF_ID_id 59ULL
-#define WT_CONF_ID_ignore_cache_size 276ULL
+#define WT_CONF_ID_ignore_cache_size 278ULL
 #define WT_CONF_ID_ignore_in_memory_cache_size 25ULL
 #define WT_CONF_ID_ignore_prepare 156ULL
 #define WT_CONF_ID_immutable 64ULL
-#define WT_CONF_ID_in_memory 301ULL
+#define WT_CONF_ID_in_memory 302ULL
 #define WT_CONF_ID_inclusive 95ULL
 #define WT_CONF_ID_index_key_columns 65ULL
 #define WT_CONF_ID_internal_item_max 26ULL
 #define WT_CONF_ID_internal_key_max 27ULL
 #define WT_CONF_ID_internal_key_truncate 28ULL
 #define WT_CONF_ID_internal_page_max 29ULL
-#define WT_CONF_ID_interval 314ULL
+#define WT_CONF_ID_interval 320ULL
 #define WT_CONF_ID_isolation 157ULL
-#define WT_CONF_ID_json 264ULL
-#define WT_CONF_ID_json_output 247ULL
+#define WT_CONF_ID_json 266ULL
+#define WT_CONF_ID_json_output 249ULL
 #define WT_CONF_ID_key_format 30ULL
 #define WT_CONF_ID_key_gap 31ULL
 #define WT_CONF_ID_keyid 21ULL
@@ -213,19 +215,19 @@
 #define WT_CONF_ID_local_retention 52ULL
 #define WT_CONF_ID_lock_wait 112ULL
 #define WT_CONF_ID_log 175ULL
-#define WT_CONF_ID_log_retention 210ULL
+#define WT_CONF_ID_log_retention 211ULL
 #define WT_CONF_ID_log_size 194ULL
 #define WT_CONF_ID_max_percent_overhead 185ULL
 #define WT_CONF_ID_memory_page_image_max 38ULL
 #define WT_CONF_ID_memory_page_max 39ULL
-#define WT_CONF_ID_merge 256ULL
+#define WT_CONF_ID_merge 258ULL
 #define WT_CONF_ID_merge_max 82ULL
 #define WT_CONF_ID_merge_min 83ULL
 #define WT_CONF_ID_metadata_file 107ULL
-#define WT_CONF_ID_method 197ULL
-#define WT_CONF_ID_mmap 305ULL
-#define WT_CONF_ID_mmap_all 306ULL
-#define WT_CONF_ID_multiprocess 307ULL
+#define WT_CONF_ID_method 198ULL
+#define WT_CONF_ID_mmap 309ULL
+#define WT_CONF_ID_mmap_all 310ULL
+#define WT_CONF_ID_multiprocess 311ULL
 #define WT_CONF_ID_name 20ULL
 #define WT_CONF_ID_next_random 135ULL
 #define WT_CONF_ID_next_random_sample_size 136ULL
@@ -233,23 +235,24 @@
 #define WT_CONF_ID_no_timestamp 158ULL
 #define WT_CONF_ID_nvram_path 186ULL
 #define WT_CONF_ID_object_target_size 53ULL
-#define WT_CONF_ID_obsolete_tw_btree_max 241ULL
+#define WT_CONF_ID_obsolete_tw_btree_max 243ULL
 #define WT_CONF_ID_old_chunks 84ULL
 #define WT_CONF_ID_oldest 88ULL
-#define WT_CONF_ID_oldest_timestamp 278ULL
-#define WT_CONF_ID_on_close 265ULL
+#define WT_CONF_ID_oldest_timestamp 280ULL
+#define WT_CONF_ID_on_close 267ULL
 #define WT_CONF_ID_operation 118ULL
 #define WT_CONF_ID_operation_timeout_ms 159ULL
 #define WT_CONF_ID_os_cache_dirty_max 40ULL
-#define WT_CONF_ID_os_cache_dirty_pct 249ULL
+#define WT_CONF_ID_os_cache_dirty_pct 251ULL
 #define WT_CONF_ID_os_cache_max 41ULL
 #define WT_CONF_ID_overwrite 91ULL
 #define WT_CONF_ID_panic_corrupt 108ULL
-#define WT_CONF_ID_path 258ULL
+#define WT_CONF_ID_parallel_walk 226ULL
+#define WT_CONF_ID_path 260ULL
 #define WT_CONF_ID_percent_file_in_dram 187ULL
-#define WT_CONF_ID_pinned 199ULL
-#define WT_CONF_ID_prealloc 250ULL
-#define WT_CONF_ID_prealloc_init_count 251ULL
+#define WT_CONF_ID_pinned 200ULL
+#define WT_CONF_ID_prealloc 252ULL
+#define WT_CONF_ID_prealloc_init_count 253ULL
 #define WT_CONF_ID_prefix 79ULL
 #define WT_CONF_ID_prefix_compression 42ULL
 #define WT_CONF_ID_prefix_compression_min 43ULL
@@ -257,40 +260,42 @@
 #define WT_CONF_ID_prepare_timestamp 164ULL
 #define WT_CONF_ID_prepared 162ULL
 #define WT_CONF_ID_priority 160ULL
-#define WT_CONF_ID_quota 261ULL
+#define WT_CONF_ID_queue_depth 304ULL
+#define WT_CONF_ID_quota 263ULL
 #define WT_CONF_ID_raw 138ULL
 #define WT_CONF_ID_read 163ULL
 #define WT_CONF_ID_read_corrupt 153ULL
 #define WT_CONF_ID_read_once 139ULL
 #define WT_CONF_ID_read_timestamp 4ULL
 #define WT_CONF_ID_readonly 60ULL
-#define WT_CONF_ID_realloc_exact 211ULL
-#define WT_CONF_ID_realloc_malloc 212ULL
-#define WT_CONF_ID_recover 304ULL
-#define WT_CONF_ID_release 201ULL
+#define WT_CONF_ID_realloc_exact 212ULL
+#define WT_CONF_ID_realloc_malloc 213ULL
+#define WT_CONF_ID_recover 307ULL
+#define WT_CONF_ID_recover_threads 308ULL
+#define WT_CONF_ID_release 202ULL
 #define WT_CONF_ID_release_evict 126ULL
-#define WT_CONF_ID_release_evict_page 275ULL
-#define WT_CONF_ID_remove 252ULL
+#define WT_CONF_ID_release_evict_page 277ULL
+#define WT_CONF_ID_remove 254ULL
 #define WT_CONF_ID_remove_files 113ULL
 #define WT_CONF_ID_remove_shared 114ULL
 #define WT_CONF_ID_repair 109ULL
-#define WT_CONF_ID_require_max 288ULL
-#define WT_CONF_ID_require_min 289ULL
-#define WT_CONF_ID_reserve 262ULL
-#define WT_CONF_ID_rollback_error 213ULL
+#define WT_CONF_ID_require_max 289ULL
+#define WT_CONF_ID_require_min 290ULL
+#define WT_CONF_ID_reserve 264ULL
+#define WT_CONF_ID_rollback_error 214ULL
 #define WT_CONF_ID_run_once 101ULL
-#define WT_CONF_ID_salvage 310ULL
-#define WT_CONF_ID_secretkey 294ULL
-#define WT_CONF_ID_session_max 311ULL
-#define WT_CONF_ID_session_scratch_max 312ULL
-#define WT_CONF_ID_session_table_cache 313ULL
+#define WT_CONF_ID_salvage 316ULL
+#define WT_CONF_ID_secretkey 295ULL
+#define WT_CONF_ID_session_max 317ULL
+#define WT_CONF_ID_session_scratch_max 318ULL
+#define WT_CONF_ID_session_table_cache 319ULL
 #define WT_CONF_ID_sessions 176ULL
 #define WT_CONF_ID_shared 54ULL
 #define WT_CONF_ID_size 183ULL
 #define WT_CONF_ID_skip_sort_check 140ULL
-#define WT_CONF_ID_slow_checkpoint 214ULL
+#define WT_CONF_ID_slow_checkpoint 215ULL
 #define WT_CONF_ID_source 8ULL
-#define WT_CONF_ID_sources 266ULL
+#define WT_CONF_ID_sources 268ULL
 #define WT_CONF_ID_split_deepen_min_child 44ULL
 #define WT_CONF_ID_split_deepen_per_child 45ULL
 #define WT_CONF_ID_split_pct 46ULL
@@ -298,45 +303,46 @@
 #define WT_CONF_ID_stable_timestamp 154ULL
 #define WT_CONF_ID_start_generation 80ULL
 #define WT_CONF_ID_statistics 141ULL
-#define WT_CONF_ID_storage_path 286ULL
+#define WT_CONF_ID_storage_path 287ULL
 #define WT_CONF_ID_strategy 119ULL
-#define WT_CONF_ID_stress_skiplist 215ULL
+#define WT_CONF_ID_stress_skiplist 216ULL
 #define WT_CONF_ID_strict 155ULL
 #define WT_CONF_ID_suffix 81ULL
 #define WT_CONF_ID_sync 120ULL
+#define WT_CONF_ID_sysfs_path 313ULL
 #define WT_CONF_ID_system_ram 188ULL
-#define WT_CONF_ID_table_logging 216ULL
+#define WT_CONF_ID_table_logging 217ULL
 #define WT_CONF_ID_target 142ULL
-#define WT_CONF_ID_terminate 272ULL
+#define WT_CONF_ID_terminate 274ULL
 #define WT_CONF_ID_this_id 134ULL
-#define WT_CONF_ID_threads 279ULL
-#define WT_CONF_ID_threads_max 222ULL
-#define WT_CONF_ID_threads_min 223ULL
-#define WT_CONF_ID_tiered_flush_error_continue 217ULL
+#define WT_CONF_ID_threads 195ULL
+#define WT_CONF_ID_threads_max 223ULL
+#define WT_CONF_ID_threads_min 224ULL
+#define WT_CONF_ID_tiered_flush_error_continue 218ULL
 #define WT_CONF_ID_tiered_object 61ULL
 #define WT_CONF_ID_tiers 89ULL
 #define WT_CONF_ID_timeout 102ULL
-#define WT_CONF_ID_timestamp 267ULL
-#define WT_CONF_ID_timing_stress_for_test 268ULL
-#define WT_CONF_ID_total 245ULL
+#define WT_CONF_ID_timestamp 269ULL
+#define WT_CONF_ID_timing_stress_for_test 270ULL
+#define WT_CONF_ID_total 247ULL
 #define WT_CONF_ID_txn 177ULL
 #define WT_CONF_ID_type 9ULL
-#define WT_CONF_ID_update_restore_evict 218ULL
-#define WT_CONF_ID_use_environment 316ULL
-#define WT_CONF_ID_use_environment_priv 317ULL
+#define WT_CONF_ID_update_restore_evict 219ULL
+#define WT_CONF_ID_use_environment 322ULL
+#define WT_CONF_ID_use_environment_priv 323ULL
 #define WT_CONF_ID_use_timestamp 168ULL
 #define WT_CONF_ID_value_format 55ULL
 #define WT_CONF_ID_verbose 10ULL
-#define WT_CONF_ID_verify_metadata 318ULL
+#define WT_CONF_ID_verify_metadata 324ULL
 #define WT_CONF_ID_version 62ULL
-#define WT_CONF_ID_wait 195ULL
-#define WT_CONF_ID_worker_thread_max 255ULL
-#define WT_CONF_ID_write_through 319ULL
+#define WT_CONF_ID_wait 196ULL
+#define WT_CONF_ID_worker_thread_max 257ULL
+#define WT_CONF_ID_write_through 325ULL
 #define WT_CONF_ID_write_timestamp 5ULL
 #define WT_CONF_ID_write_timestamp_usage 11ULL
-#define WT_CONF_ID_zero_fill 253ULL
+#define WT_CONF_ID_zero_fill 255ULL
 
-#define WT_CONF_ID_COUNT 320
+#define WT_CONF_ID_COUNT 326
 /*
  * API configuration keys: END
  */
@@ -371,6 +377,7 @@ static const struct {
     } Block_cache;
     struct {
         uint64_t log_size;
+        uint64_t threads;
         uint64_t wait;
     } Checkpoint;
     struct {
@@ -423,6 +430,7 @@ static const struct {
     } Encryption;
     struct {
         uint64_t evict_sample_inmem;
+      uint64_t parallel_walk;
         uint64_t threads_max;
         uint64_t threads_min;
     } Eviction;
@@ -470,6 +478,10 @@ static const struct {
         uint64_t chunk_cache;
         uint64_t total;
     } Io_capacity;
+    struct {
+        uint64_t enabled;
+        uint64_t queue_depth;
+    } Io_uring;
     struct {
         uint64_t archive;
         uint64_t compressor;
@@ -481,6 +493,7 @@ static const struct {
         uint64_t prealloc;
         uint64_t prealloc_init_count;
         uint64_t recover;
+      uint64_t recover_threads;
         uint64_t remove;
         uint64_t zero_fill;
     } Log;
@@ -506,6 +519,10 @@ static const struct {
         uint64_t merge;
         uint64_t worker_thread_max;
     } Lsm_manager;
+    struct {
+        uint64_t enabled;
+        uint64_t sysfs_path;
+    } Numa;
     struct {
         uint64_t enabled;
         uint64_t path;
@@ -748,6 +765,7 @@ static const struct {
   },
   {
     WT_CONF_ID_Checkpoint | (WT_CONF_ID_log_size << 16),
+    WT_CONF_ID_Checkpoint | (WT_CONF_ID_threads << 16),
     WT_CONF_ID_Checkpoint | (WT_CONF_ID_wait << 16),
   },
   {
@@ -800,6 +818,7 @@ static const struct {
   },
   {
     WT_CONF_ID_Eviction | (WT_CONF_ID_evict_sample_inmem << 16),
+      WT_CONF_ID_Eviction | (WT_CONF_ID_parallel_walk << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_threads_max << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_threads_min << 16),
   },
@@ -848,6 +867,10 @@ static const struct {
     WT_CONF_ID_Io_capacity | (WT_CONF_ID_chunk_cache << 16),
     WT_CONF_ID_Io_capacity | (WT_CONF_ID_total << 16),
   },
+  {
+    WT_CONF_ID_Io_uring | (WT_CONF_ID_enabled << 16),
+    WT_CONF_ID_Io_uring | (WT_CONF_ID_queue_depth << 16),
+  },
   {
     WT_CONF_ID_Log | (WT_CONF_ID_archive << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_compressor << 16),
@@ -859,6 +882,7 @@ static const struct {
     WT_CONF_ID_Log | (WT_CONF_ID_prealloc << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_prealloc_init_count << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_recover << 16),
+      WT_CONF_ID_Log | (WT_CONF_ID_recover_threads << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_remove << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_zero_fill << 16),
   },
@@ -884,6 +908,10 @@ static const struct {
     WT_CONF_ID_Lsm_manager | (WT_CONF_ID_merge << 16),
     WT_CONF_ID_Lsm_manager | (WT_CONF_ID_worker_thread_max << 16),
   },
+  {
+    WT_CONF_ID_Numa | (WT_CONF_ID_enabled << 16),
+    WT_CONF_ID_Numa | (WT_CONF_ID_sysfs_path << 16),
+  },
   {
     WT_CONF_ID_Operation_tracking | (WT_CONF_ID_enabled << 16),
     WT_CONF_ID_Operation_tracking | (WT_CONF_ID_path << 16),
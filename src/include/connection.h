@@ -529,6 +529,9 @@ struct __wt_connection_impl {
     wt_shared wt_off_t ckpt_logsize; /* Checkpoint log size period */
     bool ckpt_signalled;             /* Checkpoint signalled */
 
+    wt_shared uint32_t ckpt_threads; /* Checkpoint tree writing threads */
+    WT_CHECKPOINT_WORK ckpt_work;    /* Checkpoint tree writes */
+
     uint64_t ckpt_apply;           /* Checkpoint handles applied */
     uint64_t ckpt_apply_time;      /* Checkpoint applied handles gather time */
     uint64_t ckpt_drop;            /* Checkpoint handles drop */
@@ -562,9 +565,9 @@ struct __wt_connection_impl {
     struct timespec ckpt_timer_scrub_end;
 
     /* Checkpoint progress message data */
-    uint64_t ckpt_progress_msg_count;
-    uint64_t ckpt_write_bytes;
-    uint64_t ckpt_write_pages;
+    wt_shared uint64_t ckpt_progress_msg_count;
+    wt_shared uint64_t ckpt_write_bytes;
+    wt_shared uint64_t ckpt_write_pages;
 
     /* Record the important timestamps of each stage in recovery. */
     struct __wt_recovery_timeline {
@@ -600,6 +603,7 @@ struct __wt_connection_impl {
     uint64_t rec_maximum_milliseconds;      /* Maximum milliseconds reconciliation took. */
     WT_CONNECTION_STATS *stats[WT_STAT_CONN_COUNTER_SLOTS];
     WT_CONNECTION_STATS *stat_array;
+    uint16_t stat_cpu_index[WT_STAT_CPU_MAX]; /* CPU ID to statistics slot numbering */
 
     WT_CAPACITY capacity;              /* Capacity structure */
     WT_SESSION_IMPL *capacity_session; /* Capacity thread session */
@@ -621,10 +625,13 @@ struct __wt_connection_impl {
     uint32_t evict_threads_max; /* Max eviction threads */
     uint32_t evict_threads_min; /* Min eviction threads */
     bool evict_sample_inmem;
+    wt_shared bool evict_parallel_walk; /* Eviction workers walk trees */
 
 #define WT_MAX_PREFETCH_QUEUE 120
-#define WT_PREFETCH_QUEUE_PER_TRIGGER 30
+#define WT_PREFETCH_QUEUE_PER_TRIGGER_MAX WT_MAX_PREFETCH_QUEUE
+#define WT_PREFETCH_QUEUE_PER_TRIGGER_MIN 8
 #define WT_PREFETCH_THREAD_COUNT 8
+#define WT_PREFETCH_SYNC_BATCH 8
     WT_SPINLOCK prefetch_lock;
     WT_THREAD_GROUP prefetch_threads;
     uint64_t prefetch_queue_count;
@@ -736,6 +743,14 @@ struct __wt_connection_impl {
     bool mmap_all; /* use mmap for all I/O on data files */
     int page_size; /* OS page size for mmap alignment */
 
+    WT_IO_URING *io_uring; /* Asynchronous data file reads */
+
+    /* NUMA topology, set if NUMA is configured. */
+    u_int numa_nodes;           /* Number of nodes */
+    u_int numa_cpus;            /* Number of CPUs */
+    uint8_t *numa_cpu_node;     /* CPU to node map */
+    size_t numa_cpu_node_alloc; /* CPU to node map allocated size */
+
     /* Access to these fields is protected by the debug_log_retention_lock. */
     WT_LSN *debug_ckpt;                /* Debug mode checkpoint LSNs. */
     size_t debug_ckpt_alloc;           /* Checkpoint retention allocated. */
@@ -15,8 +15,8 @@
  * Initialize a static WT_CURSOR structure.
  */
 #define WT_CURSOR_STATIC_INIT(n, get_key, get_value, get_raw_key_value, set_key, set_value,      \
-  compare, equals, next, prev, reset, search, search_near, insert, modify, update, remove,       \
-  reserve, reconfigure, largest_key, bound, cache, reopen, checkpoint_id, close)                 \
+  compare, equals, next, prev, reset, search, search_near, search_batch, insert, modify, update, \
+  remove, reserve, reconfigure, largest_key, bound, cache, reopen, checkpoint_id, close)         \
     static const WT_CURSOR n = {                                                                 \
       NULL, /* session */                                                                        \
       NULL, /* uri */                                                                            \
@@ -24,19 +24,19 @@
       NULL, /* value_format */                                                                   \
       get_key, get_value, get_raw_key_value, set_key, set_value, compare, equals, next, prev,    \
       reset, search, search_near, insert, modify, update, remove, reserve, checkpoint_id, close, \
-      largest_key, reconfigure, bound, cache, reopen, 0, /* uri_hash */                          \
-      {NULL, NULL},                                      /* TAILQ_ENTRY q */                     \
-      0,                                                 /* recno key */                         \
-      {0},                                               /* recno raw buffer */                  \
-      NULL,                                              /* json_private */                      \
-      NULL,                                              /* lang_private */                      \
-      {NULL, 0, NULL, 0, 0},                             /* WT_ITEM key */                       \
-      {NULL, 0, NULL, 0, 0},                             /* WT_ITEM value */                     \
-      0,                                                 /* int saved_err */                     \
-      NULL,                                              /* internal_uri */                      \
-      {NULL, 0, NULL, 0, 0},                             /* WT_ITEM lower bound */               \
-      {NULL, 0, NULL, 0, 0},                             /* WT_ITEM upper bound */               \
-      0                                                  /* uint32_t flags */                    \
+      largest_key, reconfigure, bound, search_batch, cache, reopen, 0, /* uri_hash */            \
+      {NULL, NULL},                                                    /* TAILQ_ENTRY q */       \
+      0,                                                               /* recno key */           \
+      {0},                                                             /* recno raw buffer */    \
+      NULL,                                                            /* json_private */        \
+      NULL,                                                            /* lang_private */        \
+      {NULL, 0, NULL, 0, 0},                                           /* WT_ITEM key */         \
+      {NULL, 0, NULL, 0, 0},                                           /* WT_ITEM value */       \
+      0,                                                               /* int saved_err */       \
+      NULL,                                                            /* internal_uri */        \
+      {NULL, 0, NULL, 0, 0},                                           /* WT_ITEM lower bound */ \
+      {NULL, 0, NULL, 0, 0},                                           /* WT_ITEM upper bound */ \
+      0                                                                /* uint32_t flags */      \
     }
 
 /* Call a function without the evict reposition cursor flag, restore afterwards. */
@@ -295,6 +295,46 @@ __wt_failpoint(WT_SESSION_IMPL *session, uint64_t conn_flag, u_int probability)
     return (__wt_random(&session->rnd) % (10 * WT_THOUSAND) <= probability);
 }
 
+/*
+ * __wt_stats_slot_refresh --
+ *     Point the session's statistics at the slots of the CPU it's running on.
+ */
+static WT_INLINE void
+__wt_stats_slot_refresh(WT_SESSION_IMPL *session)
+{
+#ifdef __linux__
+    u_int cpu_index;
+    int cpu;
+
+    /*
+     * The thread can migrate after we look, that only costs a shared cache line until the buckets
+     * are next chosen. Where the CPU isn't available, the session ID chosen at open is kept.
+     */
+    if (WT_STAT_ENABLED(session) && (cpu = sched_getcpu()) >= 0) {
+        cpu_index = cpu < WT_STAT_CPU_MAX ? S2C(session)->stat_cpu_index[cpu] : (u_int)cpu;
+        session->stat_conn_bucket = cpu_index % WT_STAT_CONN_COUNTER_SLOTS;
+        session->stat_dsrc_bucket = cpu_index % WT_STAT_DSRC_COUNTER_SLOTS;
+    }
+#else
+    WT_UNUSED(session);
+#endif
+}
+
+/*
+ * __wt_stats_slot_api_call --
+ *     Refresh the session's statistics slots once every WT_STATS_SLOT_REFRESH top-level API calls.
+ */
+static WT_INLINE void
+__wt_stats_slot_api_call(WT_SESSION_IMPL *session)
+{
+    /*
+     * Threads rarely move between CPUs from one call to the next, don't pay for finding the CPU on
+     * every short call such as a cursor search.
+     */
+    if (session->stat_slot_calls++ % WT_STATS_SLOT_REFRESH == 0)
+        __wt_stats_slot_refresh(session);
+}
+
 /*
  * __wt_set_shared_double --
  *     This function enables suppressing TSan warnings about setting doubles in a shared context.
@@ -168,6 +168,52 @@ struct __wt_file_handle_inmem {
     u_int ref;   /* Reference count */
 };
 
+/*
+ * WT_IO_REQ --
+ *	An asynchronous read request: the read is submitted and the caller later waits for it to
+ * complete, the data is returned in the request's buffer.
+ */
+struct __wt_io_req {
+    WT_FH *fh;       /* File handle */
+    wt_off_t offset; /* Read offset */
+    size_t len;      /* Read length */
+    WT_ITEM buf;     /* Read buffer */
+
+    wt_shared volatile bool done; /* Read complete */
+    int ret;                      /* Read return */
+    size_t nbytes;                /* Bytes read */
+};
+
+/*
+ * WT_IO_URING --
+ *	A connection's io_uring submission and completion queues. The ring memory is shared with the
+ * kernel, the head/tail pointers reference the shared mappings.
+ */
+struct __wt_io_uring {
+    int fd;         /* Ring file descriptor */
+    uint32_t depth; /* Submission queue entries */
+
+    wt_shared volatile uint32_t inflight; /* Reads submitted and not yet reaped */
+
+    WT_SPINLOCK sq_lock; /* Submission queue lock */
+    void *sq_ring;       /* Submission queue mapping */
+    size_t sq_ring_size;
+    uint32_t *sq_tail;
+    uint32_t *sq_mask;
+    uint32_t *sq_array;
+    void *sqes; /* Submission queue entries mapping */
+    size_t sqes_size;
+
+    WT_SPINLOCK cq_lock; /* Completion queue lock */
+    WT_CONDVAR *cq_cond; /* Completion queue waiters */
+    void *cq_ring;       /* Completion queue mapping */
+    size_t cq_ring_size;
+    uint32_t *cq_head;
+    uint32_t *cq_tail;
+    uint32_t *cq_mask;
+    void *cqes;
+};
+
 struct __wt_fstream {
     const char *name; /* Stream name */
 
@@ -57,6 +57,7 @@ struct __wt_prefetch {
     WT_PAGE *prefetch_prev_ref_home;
     uint64_t prefetch_disk_read_count; /* Sequential cache requests that caused a leaf read */
     uint64_t prefetch_skipped_with_parent;
+    uint64_t prefetch_window; /* Pages queued by the last trigger, 0 to restart the ramp */
 };
 
 /* Get the connection implementation for a session */
@@ -249,8 +250,13 @@ struct __wt_session_impl {
     /* Sessions have an associated statistics bucket based on its ID. */
     u_int stat_conn_bucket;     /* Statistics connection bucket offset */
     u_int stat_dsrc_bucket;     /* Statistics data source bucket offset */
+    u_int stat_slot_calls;      /* API calls since the buckets were last chosen */
     uint64_t cache_max_wait_us; /* Maximum time an operation waits for space in cache */
 
+    /* Eviction threads are bound to a NUMA node if NUMA is configured. */
+    bool numa_bound; /* Thread is bound to a NUMA node */
+    u_int numa_node; /* The bound node */
+
 #ifdef HAVE_DIAGNOSTIC
     uint8_t dump_raw; /* Configure debugging page dump */
 #endif
@@ -292,24 +298,25 @@ struct __wt_session_impl {
 #define WT_SESSION_BACKUP_DUP 0x000002u
 #define WT_SESSION_CACHE_CURSORS 0x000004u
 #define WT_SESSION_CAN_WAIT 0x000008u
-#define WT_SESSION_DEBUG_CHECKPOINT_FAIL_BEFORE_TURTLE_UPDATE 0x000010u
-#define WT_SESSION_DEBUG_DO_NOT_CLEAR_TXN_ID 0x000020u
-#define WT_SESSION_DEBUG_RELEASE_EVICT 0x000040u
-#define WT_SESSION_EVICTION 0x000080u
-#define WT_SESSION_IGNORE_CACHE_SIZE 0x000100u
-#define WT_SESSION_IMPORT 0x000200u
-#define WT_SESSION_IMPORT_REPAIR 0x000400u
-#define WT_SESSION_INTERNAL 0x000800u
-#define WT_SESSION_LOGGING_INMEM 0x001000u
-#define WT_SESSION_NO_DATA_HANDLES 0x002000u
-#define WT_SESSION_NO_RECONCILE 0x004000u
-#define WT_SESSION_PREFETCH_ENABLED 0x008000u
-#define WT_SESSION_PREFETCH_THREAD 0x010000u
-#define WT_SESSION_QUIET_CORRUPT_FILE 0x020000u
-#define WT_SESSION_READ_WONT_NEED 0x040000u
-#define WT_SESSION_RESOLVING_TXN 0x080000u
-#define WT_SESSION_ROLLBACK_TO_STABLE 0x100000u
-#define WT_SESSION_SCHEMA_TXN 0x200000u
+#define WT_SESSION_CHECKPOINT_THREAD 0x000010u
+#define WT_SESSION_DEBUG_CHECKPOINT_FAIL_BEFORE_TURTLE_UPDATE 0x000020u
+#define WT_SESSION_DEBUG_DO_NOT_CLEAR_TXN_ID 0x000040u
+#define WT_SESSION_DEBUG_RELEASE_EVICT 0x000080u
+#define WT_SESSION_EVICTION 0x000100u
+#define WT_SESSION_IGNORE_CACHE_SIZE 0x000200u
+#define WT_SESSION_IMPORT 0x000400u
+#define WT_SESSION_IMPORT_REPAIR 0x000800u
+#define WT_SESSION_INTERNAL 0x001000u
+#define WT_SESSION_LOGGING_INMEM 0x002000u
+#define WT_SESSION_NO_DATA_HANDLES 0x004000u
+#define WT_SESSION_NO_RECONCILE 0x008000u
+#define WT_SESSION_PREFETCH_ENABLED 0x010000u
+#define WT_SESSION_PREFETCH_THREAD 0x020000u
+#define WT_SESSION_QUIET_CORRUPT_FILE 0x040000u
+#define WT_SESSION_READ_WONT_NEED 0x080000u
+#define WT_SESSION_RESOLVING_TXN 0x100000u
+#define WT_SESSION_ROLLBACK_TO_STABLE 0x200000u
+#define WT_SESSION_SCHEMA_TXN 0x400000u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t flags;
 
@@ -341,7 +348,8 @@ struct __wt_session_impl {
 #define WT_GEN_HAZARD 3       /* Hazard pointer */
 #define WT_GEN_SPLIT 4        /* Page splits */
 #define WT_GEN_TXN_COMMIT 5   /* Commit generation */
-#define WT_GENERATIONS 6      /* Total generation manager entries */
+#define WT_GEN_BLKCACHE 6     /* Block cache lookups */
+#define WT_GENERATIONS 7      /* Total generation manager entries */
     wt_shared volatile uint64_t generations[WT_GENERATIONS];
 
     /*
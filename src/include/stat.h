@@ -73,9 +73,18 @@
  *
  * Our solution is to use the session ID; there is normally a session per thread and the session ID
  * is a small, monotonically increasing number.
+ *
+ * Where the CPU ID is cheap to get (Linux, where sched_getcpu is answered without a system call),
+ * the slot IDs are replaced with the CPU's every WT_STATS_SLOT_REFRESH top-level API calls and when
+ * a thread wakes from a wait, so threads running concurrently write different structures no matter
+ * how many sessions there are. CPUs are numbered by their position in the process's affinity mask
+ * when the connection is opened, so a process using no more CPUs than there are slots never shares
+ * a slot between CPUs, whatever the CPU IDs. CPU IDs of WT_STAT_CPU_MAX and above are used as-is.
  */
 #define WT_STATS_CONN_SLOT_ID(session) (((session)->id) % WT_STAT_CONN_COUNTER_SLOTS)
 #define WT_STATS_DSRC_SLOT_ID(session) (((session)->id) % WT_STAT_DSRC_COUNTER_SLOTS)
+#define WT_STATS_SLOT_REFRESH 16
+#define WT_STAT_CPU_MAX 1024
 
 /*
  * Statistic structures are arrays of int64_t's. We have functions to read/write those structures
@@ -467,8 +476,14 @@ struct __wt_connection_stats {
     int64_t block_cache_bytes;
     int64_t block_cache_bytes_insert_read;
     int64_t block_cache_bytes_insert_write;
+    int64_t block_read_async_discard;
+    int64_t block_read_async_hit;
+    int64_t block_read_io_uring_completed;
+    int64_t block_read_io_uring_sync;
+    int64_t block_read_io_uring_submitted;
     int64_t block_preload;
     int64_t block_read;
+    int64_t block_read_async_coalesced;
     int64_t block_write;
     int64_t block_byte_read;
     int64_t block_byte_read_mmap;
@@ -521,6 +536,7 @@ struct __wt_connection_stats {
     int64_t eviction_server_skip_pages_retry;
     int64_t eviction_server_skip_unwanted_pages;
     int64_t eviction_server_skip_unwanted_tree;
+	int64_t eviction_server_skip_trees_worker_walk;
     int64_t eviction_server_skip_checkpointing_trees;
     int64_t eviction_server_skip_trees_stick_in_cache;
     int64_t eviction_server_skip_trees_eviction_disabled;
@@ -543,6 +559,7 @@ struct __wt_connection_stats {
     int64_t eviction_target_strategy_clean;
     int64_t eviction_target_strategy_dirty;
     int64_t eviction_walks_abandoned;
+	int64_t eviction_worker_walk;
     int64_t eviction_walks_stopped;
     int64_t eviction_walks_gave_up_no_targets;
     int64_t eviction_walks_gave_up_ratio;
@@ -618,6 +635,7 @@ struct __wt_connection_stats {
     int64_t cache_eviction_dirty_obsolete_tw;
     int64_t eviction_pages_in_parallel_with_checkpoint;
     int64_t eviction_pages_ordinary_queued;
+	int64_t eviction_worker_walk_pages_merged;
     int64_t eviction_pages_queued_post_lru;
     int64_t eviction_pages_queued_urgent;
     int64_t eviction_pages_queued_oldest;
@@ -631,6 +649,7 @@ struct __wt_connection_stats {
     int64_t cache_pages_prefetch;
     int64_t cache_eviction_pages_seen;
     int64_t eviction_pages_already_queued;
+    int64_t eviction_worker_numa_local;
     int64_t eviction_fail;
     int64_t eviction_fail_active_children_on_an_internal_page;
     int64_t eviction_fail_in_reconciliation;
@@ -822,6 +841,8 @@ struct __wt_connection_stats {
     int64_t cursor_reserve_error;
     int64_t cursor_reset;
     int64_t cursor_reset_error;
+    int64_t cursor_search_batch;
+    int64_t cursor_search_batch_error;
     int64_t cursor_search;
     int64_t cursor_search_error;
     int64_t cursor_search_hs;
@@ -896,6 +917,7 @@ struct __wt_connection_stats {
     int64_t log_write_lsn;
     int64_t log_write_lsn_skip;
     int64_t log_sync;
+    int64_t log_sync_group;
     int64_t log_sync_duration;
     int64_t log_sync_dir;
     int64_t log_sync_dir_duration;
@@ -1121,6 +1143,7 @@ struct __wt_connection_stats {
     int64_t txn_pinned_timestamp_oldest;
     int64_t txn_timestamp_oldest_active_read;
     int64_t txn_rollback_to_stable_running;
+    int64_t txn_snapshot_cache_hit;
     int64_t txn_walk_sessions;
     int64_t txn_commit;
     int64_t txn_rollback;
@@ -1351,6 +1374,7 @@ struct __wt_dsrc_stats {
     int64_t cursor_reopen_error;
     int64_t cursor_reserve_error;
     int64_t cursor_reset_error;
+    int64_t cursor_search_batch_error;
     int64_t cursor_search_error;
     int64_t cursor_search_near_error;
     int64_t cursor_update_error;
@@ -1367,6 +1391,7 @@ struct __wt_dsrc_stats {
     int64_t cursor_remove_bytes;
     int64_t cursor_reserve;
     int64_t cursor_reset;
+    int64_t cursor_search_batch;
     int64_t cursor_search;
     int64_t cursor_search_hs;
     int64_t cursor_search_near;
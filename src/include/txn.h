@@ -65,8 +65,14 @@ typedef enum {
     (S2C(s)->txn_global.txn_shared_list == NULL ? NULL : \
                                                   &S2C(s)->txn_global.txn_shared_list[(s)->id])
 
-#define WT_SESSION_IS_CHECKPOINT(s) \
+/*
+ * A checkpoint's work is done by the session running the checkpoint transaction and by any threads
+ * writing trees for it under the checkpoint's snapshot.
+ */
+#define WT_SESSION_IS_CHECKPOINT_TXN(s) \
     ((s)->id != 0 && (s)->id == __wt_atomic_loadv32(&S2C(s)->txn_global.checkpoint_id))
+#define WT_SESSION_IS_CHECKPOINT(s) \
+    (WT_SESSION_IS_CHECKPOINT_TXN(s) || F_ISSET(s, WT_SESSION_CHECKPOINT_THREAD))
 
 /*
  * Perform an operation at the specified isolation level.
@@ -188,6 +194,26 @@ struct __wt_txn_global {
     wt_shared volatile uint64_t metadata_pinned; /* Oldest ID for metadata */
 
     WT_TXN_SHARED *txn_shared_list; /* Per-session shared transaction states */
+
+    /*
+     * Bumped each time a transaction ID is cleared from the shared list. Together with the current
+     * ID it identifies the set of running transactions: if neither has changed, no ID has been
+     * allocated or released and a snapshot built earlier is still the correct one.
+     */
+    wt_shared volatile uint64_t txn_release_gen;
+
+    /*
+     * The concurrent IDs found by the most recent walk of the shared list, tagged with the current
+     * ID and release generation it was taken at. Readers copy it under a sequence count, odd while
+     * a publisher holding the lock is rewriting it.
+     */
+    WT_SPINLOCK snapshot_cache_lock;
+    wt_shared volatile uint64_t snapshot_cache_seq;
+    wt_shared uint64_t snapshot_cache_current;
+    wt_shared uint64_t snapshot_cache_release_gen;
+    wt_shared uint64_t snapshot_cache_pinned;
+    wt_shared uint32_t snapshot_cache_count;
+    wt_shared uint64_t *snapshot_cache;
 };
 
 typedef enum __wt_txn_isolation {
@@ -394,3 +420,34 @@ struct __wt_txn {
      */
     uint64_t __snapshot[];
 };
+
+/*
+ * WT_CHECKPOINT_WORK_UNIT --
+ *	A tree written by a checkpoint.
+ */
+struct __wt_checkpoint_work_unit {
+    WT_DATA_HANDLE *dhandle; /* Tree being checkpointed */
+    WT_LSN ckptlsn;          /* Checkpoint LSN */
+    bool fake_ckpt;          /* Checkpoint is faked, nothing to write */
+    bool resolve_bm;         /* Block manager checkpoint needs resolving */
+    int ret;                 /* Result of writing the tree */
+    wt_shared bool written;  /* Tree write finished */
+};
+
+/*
+ * WT_CHECKPOINT_WORK --
+ *	Trees of a database checkpoint being written by a group of threads.
+ */
+struct __wt_checkpoint_work {
+    WT_SESSION_IMPL *session;      /* Checkpoint session */
+    wt_timestamp_t read_timestamp; /* Checkpoint read timestamp, if any */
+
+    WT_THREAD_GROUP threads; /* Threads writing the trees, kept between checkpoints */
+    WT_CONDVAR *done_cond;   /* Signalled when a tree is written */
+
+    WT_SPINLOCK lock;               /* Protects claiming trees */
+    WT_CHECKPOINT_WORK_UNIT *units; /* Trees being written */
+    uint32_t entries;
+    uint32_t next;         /* Next tree to claim */
+    wt_shared bool failed; /* A tree write failed, stop writing */
+};
@@ -119,6 +119,10 @@ struct __wt_cell_unpack_kv;
 typedef struct __wt_cell_unpack_kv WT_CELL_UNPACK_KV;
 struct __wt_checkpoint_cleanup;
 typedef struct __wt_checkpoint_cleanup WT_CHECKPOINT_CLEANUP;
+struct __wt_checkpoint_work;
+typedef struct __wt_checkpoint_work WT_CHECKPOINT_WORK;
+struct __wt_checkpoint_work_unit;
+typedef struct __wt_checkpoint_work_unit WT_CHECKPOINT_WORK_UNIT;
 struct __wt_chunkcache;
 typedef struct __wt_chunkcache WT_CHUNKCACHE;
 struct __wt_chunkcache_bucket;
@@ -269,6 +273,10 @@ struct __wt_insert;
 typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
 typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_io_req;
+typedef struct __wt_io_req WT_IO_REQ;
+struct __wt_io_uring;
+typedef struct __wt_io_uring WT_IO_URING;
 struct __wt_join_stats;
 typedef struct __wt_join_stats WT_JOIN_STATS;
 struct __wt_join_stats_group;
@@ -369,6 +377,8 @@ struct __wt_rollback_to_stable;
 typedef struct __wt_rollback_to_stable WT_ROLLBACK_TO_STABLE;
 struct __wt_row;
 typedef struct __wt_row WT_ROW;
+struct __wt_row_srch_index;
+typedef struct __wt_row_srch_index WT_ROW_SRCH_INDEX;
 struct __wt_rts_cookie;
 typedef struct __wt_rts_cookie WT_RTS_COOKIE;
 struct __wt_rts_work_unit;
@@ -511,7 +521,7 @@ typedef uint64_t wt_timestamp_t;
 #include "stat.h"         /* required by dhandle.h */
 #include "dhandle.h"      /* required by btree.h, connection.h */
 #include "timestamp.h"    /* required by reconcile.h */
-#include "thread_group.h" /* required by rollback_to_stable.h */
+#include "thread_group.h" /* required by rollback_to_stable.h, txn.h */
 
 #include "api.h"
 #include "bitstring.h"
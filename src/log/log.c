@@ -1916,7 +1916,7 @@ __wti_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_LOG *log;
-    WT_LSN sync_lsn;
+    WT_LSN sync_lsn, write_lsn;
     int64_t release_buffered, release_bytes;
 
     conn = S2C(session);
@@ -2012,9 +2012,16 @@ __wti_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
 
         /*
          * Record the current end of our update after the lock. That is how far our calls can
-         * guarantee.
+         * guarantee. Slots released while the previous sync ran have already been written: if they
+         * are in the same file, sync through them as well so their threads find their records
+         * durable instead of queuing for a sync each.
          */
         WT_ASSIGN_LSN(&sync_lsn, &slot->slot_end_lsn);
+        WT_ASSIGN_LSN(&write_lsn, &log->write_lsn);
+        if (write_lsn.l.file == sync_lsn.l.file && __wt_log_cmp(&write_lsn, &sync_lsn) > 0) {
+            WT_ASSIGN_LSN(&sync_lsn, &write_lsn);
+            WT_STAT_CONN_INCR(session, log_sync_group);
+        }
         /*
          * Check if we have to sync the parent directory. Some combinations of sync flags may result
          * in the log file not yet stable in its parent directory. Do that now if needed.
@@ -553,3 +553,71 @@ err:
     __wt_scr_free(session, &zerobuf);
     return (ret);
 }
+
+/*
+ * __wt_read_async --
+ *     Start an asynchronous read of a file handle into the request's buffer. If the connection
+ *     isn't configured for asynchronous reads, or the read can't be submitted, the read is done
+ *     synchronously.
+ */
+int
+__wt_read_async(WT_SESSION_IMPL *session, WT_FH *fh, wt_off_t offset, size_t len, WT_IO_REQ *req)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    req->fh = fh;
+    req->offset = offset;
+    req->len = len;
+    req->done = false;
+    req->ret = 0;
+    req->nbytes = 0;
+
+    /* The buffer may be used for direct I/O. */
+    F_SET(&req->buf, WT_ITEM_ALIGNED);
+    WT_ERR(__wt_buf_init(session, &req->buf, len));
+    req->buf.size = len;
+
+    if (conn->io_uring != NULL && fh->file_type == WT_FS_OPEN_FILE_TYPE_DATA) {
+        if (__wt_io_uring_read(session, conn->io_uring, req) == 0)
+            return (0);
+        WT_STAT_CONN_INCR(session, block_read_io_uring_sync);
+    }
+
+    WT_ERR(__wt_read(session, fh, offset, len, req->buf.mem));
+    req->nbytes = len;
+    WT_RELEASE_WRITE(req->done, true);
+    return (0);
+
+err:
+    /* The caller doesn't own a failed request, don't leave the buffer behind. */
+    __wt_buf_free(session, &req->buf);
+    return (ret);
+}
+
+/*
+ * __wt_read_async_wait --
+ *     Wait for an asynchronous read to complete.
+ */
+int
+__wt_read_async_wait(WT_SESSION_IMPL *session, WT_IO_REQ *req)
+{
+    bool done;
+
+    WT_ACQUIRE_READ(done, req->done);
+    if (!done)
+        WT_RET(__wt_io_uring_wait(session, S2C(session)->io_uring, req));
+
+    /*
+     * Failed and short reads are retried synchronously, so errors are handled and reported the same
+     * way as any other read.
+     */
+    if (req->ret != 0 || req->nbytes != req->len) {
+        WT_RET(__wt_read(session, req->fh, req->offset, req->len, req->buf.mem));
+        req->ret = 0;
+        req->nbytes = req->len;
+    }
+    return (0);
+}
@@ -0,0 +1,209 @@
+/*-
+ * Copyright (c) 2024-present MongoDB, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#ifdef __linux__
+/*
+ * __numa_list_next --
+ *     Return the next range of a Linux CPU or node list ("0-3,8,10-11").
+ */
+static bool
+__numa_list_next(const char **listp, u_long *firstp, u_long *lastp)
+{
+    char *end;
+    const char *list;
+
+    list = *listp;
+    *firstp = *lastp = strtoul(list, &end, 10);
+    if (end == list)
+        return (false);
+    if (*end == '-') {
+        list = end + 1;
+        *lastp = strtoul(list, &end, 10);
+        if (end == list || *lastp < *firstp)
+            return (false);
+    }
+    *listp = *end == ',' ? end + 1 : end;
+    return (true);
+}
+
+/*
+ * __numa_list_read --
+ *     Read a list from a sysfs file, a file that doesn't exist is an empty list.
+ */
+static void
+__numa_list_read(const char *path, char *buf, size_t len)
+{
+    FILE *fp;
+
+    buf[0] = '\0';
+    if ((fp = fopen(path, "r")) == NULL)
+        return;
+    if (fgets(buf, (int)len, fp) == NULL)
+        buf[0] = '\0';
+    (void)fclose(fp);
+}
+
+/*
+ * __numa_cpulist_parse --
+ *     Parse a node's CPU list and map the listed CPUs to the node, returning the number of CPUs.
+ */
+static int
+__numa_cpulist_parse(WT_SESSION_IMPL *session, const char *list, u_int node, u_int *cpusp)
+{
+    WT_CONNECTION_IMPL *conn;
+    u_long first, last;
+
+    conn = S2C(session);
+    *cpusp = 0;
+
+    while (__numa_list_next(&list, &first, &last)) {
+        if (last >= WT_NUMA_CPUS_MAX)
+            WT_RET_MSG(session, EINVAL, "NUMA CPU %lu is larger than the maximum of %d", last,
+              WT_NUMA_CPUS_MAX - 1);
+        WT_RET(__wt_realloc_def(
+          session, &conn->numa_cpu_node_alloc, (size_t)last + 1, &conn->numa_cpu_node));
+        for (; first <= last; ++first, ++*cpusp)
+            conn->numa_cpu_node[first] = (uint8_t)node;
+        if (conn->numa_cpus < last + 1)
+            conn->numa_cpus = (u_int)last + 1;
+    }
+    return (0);
+}
+#endif
+
+/*
+ * __wt_numa_setup --
+ *     Discover the system's NUMA topology.
+ */
+int
+__wt_numa_setup(WT_SESSION_IMPL *session, const char *cfg[])
+{
+#ifdef __linux__
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(path);
+    WT_DECL_RET;
+    u_long id, id_first, id_last;
+    u_int cpus;
+    char buf[1024], ids[1024];
+    const char *id_list;
+
+    conn = S2C(session);
+
+    WT_RET(__wt_config_gets(session, cfg, "numa.sysfs_path", &cval));
+    WT_RET(__wt_scr_alloc(session, 0, &path));
+
+    /*
+     * The online nodes are listed in sysfs, with a list of CPUs for each node. Nodes can be
+     * numbered sparsely, and a node can have memory but no CPUs: pages are placed on the node of
+     * the thread creating them, so only nodes with CPUs are tracked. Number those nodes densely, a
+     * page's node and an eviction thread's node are indices into the list of nodes with CPUs.
+     */
+    WT_ERR(__wt_buf_fmt(session, path, "%.*s/online", (int)cval.len, cval.str));
+    __numa_list_read(path->data, ids, sizeof(ids));
+    for (id_list = ids; __numa_list_next(&id_list, &id_first, &id_last);)
+        for (id = id_first; id <= id_last; ++id) {
+            WT_ERR(__wt_buf_fmt(
+              session, path, "%.*s/node%lu/cpulist", (int)cval.len, cval.str, id));
+            __numa_list_read(path->data, buf, sizeof(buf));
+            WT_ERR(__numa_cpulist_parse(session, buf, conn->numa_nodes, &cpus));
+            if (cpus == 0)
+                continue;
+            if (conn->numa_nodes == WT_NUMA_NODES_MAX)
+                WT_ERR_MSG(
+                  session, ENOTSUP, "more than %d NUMA nodes with CPUs", WT_NUMA_NODES_MAX);
+            ++conn->numa_nodes;
+        }
+    if (conn->numa_nodes == 0)
+        WT_ERR_MSG(session, ENOTSUP, "unable to discover the system's NUMA topology");
+
+    __wt_verbose_info(session, WT_VERB_EVICTION, "NUMA configured: %u nodes with CPUs, %u CPUs",
+      conn->numa_nodes, conn->numa_cpus);
+
+    if (0) {
+err:
+        __wt_numa_destroy(session);
+    }
+    __wt_scr_free(session, &path);
+    return (ret);
+#else
+    WT_UNUSED(cfg);
+    WT_RET_MSG(session, ENOTSUP, "NUMA support is only available on Linux");
+#endif
+}
+
+/*
+ * __wt_numa_destroy --
+ *     Discard the NUMA topology.
+ */
+void
+__wt_numa_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    __wt_free(session, conn->numa_cpu_node);
+    conn->numa_cpu_node_alloc = 0;
+    conn->numa_cpus = conn->numa_nodes = 0;
+}
+
+/*
+ * __wt_numa_node --
+ *     Return the NUMA node of the CPU the calling thread is running on.
+ */
+u_int
+__wt_numa_node(WT_SESSION_IMPL *session)
+{
+#ifdef __linux__
+    WT_CONNECTION_IMPL *conn;
+    int cpu;
+
+    conn = S2C(session);
+
+    /* The thread can migrate at any time, the answer is only a hint. */
+    if ((cpu = sched_getcpu()) < 0 || (u_int)cpu >= conn->numa_cpus)
+        return (0);
+    return (conn->numa_cpu_node[cpu]);
+#else
+    WT_UNUSED(session);
+    return (0);
+#endif
+}
+
+/*
+ * __wt_numa_bind --
+ *     Bind the calling thread to the CPUs of a NUMA node.
+ */
+int
+__wt_numa_bind(WT_SESSION_IMPL *session, u_int node)
+{
+#ifdef __linux__
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    cpu_set_t cpus;
+    u_int cpu;
+
+    conn = S2C(session);
+
+    CPU_ZERO(&cpus);
+    for (cpu = 0; cpu < conn->numa_cpus; ++cpu)
+        if (conn->numa_cpu_node[cpu] == node)
+            CPU_SET(cpu, &cpus);
+    if (CPU_COUNT(&cpus) == 0)
+        return (0);
+
+    WT_SYSCALL(pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus), ret);
+    return (ret);
+#else
+    WT_UNUSED(session);
+    WT_UNUSED(node);
+    return (ENOTSUP);
+#endif
+}
@@ -0,0 +1,299 @@
+/*-
+ * Copyright (c) 2024-present MongoDB, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#ifdef HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/*
+ * We don't depend on liburing, the ring is set up and driven with the raw system calls. Older C
+ * libraries don't define the system call numbers, they're the same on every architecture.
+ */
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+
+/*
+ * __uring_setup --
+ *     Call io_uring_setup.
+ */
+static int
+__uring_setup(uint32_t entries, struct io_uring_params *p)
+{
+    return ((int)syscall(__NR_io_uring_setup, entries, p));
+}
+
+/*
+ * __uring_enter --
+ *     Call io_uring_enter.
+ */
+static int
+__uring_enter(int fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags)
+{
+    return ((int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0));
+}
+
+/*
+ * __uring_reap --
+ *     Reap any completed reads from the completion queue, returning the number reaped. Called with
+ *     the completion queue lock held.
+ */
+static uint32_t
+__uring_reap(WT_SESSION_IMPL *session, WT_IO_URING *ring)
+{
+    struct io_uring_cqe *cqe;
+    WT_IO_REQ *req;
+    uint32_t head, reaped, tail;
+
+    head = *ring->cq_head;
+    WT_ACQUIRE_READ(tail, *ring->cq_tail);
+    for (reaped = 0; head != tail; ++head, ++reaped) {
+        cqe = &((struct io_uring_cqe *)ring->cqes)[head & *ring->cq_mask];
+        req = (WT_IO_REQ *)(uintptr_t)cqe->user_data;
+        if (cqe->res < 0)
+            req->ret = -cqe->res;
+        else
+            req->nbytes = (size_t)cqe->res;
+        WT_RELEASE_WRITE(req->done, true);
+    }
+    if (reaped == 0)
+        return (0);
+
+    /* Return the completion queue entries to the kernel. */
+    WT_RELEASE_WRITE(*ring->cq_head, head);
+    (void)__wt_atomic_subv32(&ring->inflight, reaped);
+    WT_STAT_CONN_INCRV(session, block_read_io_uring_completed, reaped);
+    return (reaped);
+}
+#endif
+
+/*
+ * __wt_io_uring_create --
+ *     Create a connection's io_uring.
+ */
+int
+__wt_io_uring_create(WT_SESSION_IMPL *session, uint32_t depth, WT_IO_URING **ringp)
+{
+#ifdef HAVE_LINUX_IO_URING_H
+    struct io_uring_params p;
+    WT_DECL_RET;
+    WT_IO_URING *ring;
+    void *mem;
+
+    *ringp = NULL;
+
+    WT_RET(__wt_calloc_one(session, &ring));
+    ring->fd = -1;
+    WT_ERR(__wt_spin_init(session, &ring->sq_lock, "io_uring submission queue"));
+    WT_ERR(__wt_spin_init(session, &ring->cq_lock, "io_uring completion queue"));
+    WT_ERR(__wt_cond_alloc(session, "io_uring completion", &ring->cq_cond));
+
+    WT_CLEAR(p);
+    if ((ring->fd = __uring_setup(depth, &p)) < 0) {
+        ret = __wt_errno();
+        WT_ERR_MSG(session, ret, "io_uring_setup");
+    }
+
+    /* The kernel rounds the queue depth up to a power of two. */
+    ring->depth = p.sq_entries;
+
+    ring->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+    mem = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+      ring->fd, IORING_OFF_SQ_RING);
+    if (mem == MAP_FAILED) {
+        ret = __wt_errno();
+        WT_ERR_MSG(session, ret, "io_uring submission queue mmap");
+    }
+    ring->sq_ring = mem;
+    ring->sq_tail = (uint32_t *)((uint8_t *)mem + p.sq_off.tail);
+    ring->sq_mask = (uint32_t *)((uint8_t *)mem + p.sq_off.ring_mask);
+    ring->sq_array = (uint32_t *)((uint8_t *)mem + p.sq_off.array);
+
+    ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    mem = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+      IORING_OFF_SQES);
+    if (mem == MAP_FAILED) {
+        ret = __wt_errno();
+        WT_ERR_MSG(session, ret, "io_uring submission queue entries mmap");
+    }
+    ring->sqes = mem;
+
+    ring->cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    mem = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+      ring->fd, IORING_OFF_CQ_RING);
+    if (mem == MAP_FAILED) {
+        ret = __wt_errno();
+        WT_ERR_MSG(session, ret, "io_uring completion queue mmap");
+    }
+    ring->cq_ring = mem;
+    ring->cq_head = (uint32_t *)((uint8_t *)mem + p.cq_off.head);
+    ring->cq_tail = (uint32_t *)((uint8_t *)mem + p.cq_off.tail);
+    ring->cq_mask = (uint32_t *)((uint8_t *)mem + p.cq_off.ring_mask);
+    ring->cqes = (uint8_t *)mem + p.cq_off.cqes;
+
+    *ringp = ring;
+    return (0);
+
+err:
+    WT_TRET(__wt_io_uring_destroy(session, &ring));
+    return (ret);
+#else
+    WT_UNUSED(depth);
+
+    *ringp = NULL;
+    WT_RET_MSG(session, ENOTSUP, "io_uring support was not configured in this build");
+#endif
+}
+
+/*
+ * __wt_io_uring_destroy --
+ *     Destroy a connection's io_uring.
+ */
+int
+__wt_io_uring_destroy(WT_SESSION_IMPL *session, WT_IO_URING **ringp)
+{
+    WT_DECL_RET;
+    WT_IO_URING *ring;
+
+    if ((ring = *ringp) == NULL)
+        return (0);
+    *ringp = NULL;
+
+    WT_ASSERT(session, ring->inflight == 0);
+
+#ifdef HAVE_LINUX_IO_URING_H
+    if (ring->cq_ring != NULL && munmap(ring->cq_ring, ring->cq_ring_size) != 0)
+        WT_TRET(__wt_errno());
+    if (ring->sqes != NULL && munmap(ring->sqes, ring->sqes_size) != 0)
+        WT_TRET(__wt_errno());
+    if (ring->sq_ring != NULL && munmap(ring->sq_ring, ring->sq_ring_size) != 0)
+        WT_TRET(__wt_errno());
+    if (ring->fd != -1 && close(ring->fd) != 0)
+        WT_TRET(__wt_errno());
+#endif
+
+    __wt_spin_destroy(session, &ring->sq_lock);
+    __wt_spin_destroy(session, &ring->cq_lock);
+    __wt_cond_destroy(session, &ring->cq_cond);
+    __wt_free(session, ring);
+    return (ret);
+}
+
+/*
+ * __wt_io_uring_read --
+ *     Submit an asynchronous read. Returns EBUSY if the ring is full, the caller is expected to
+ *     fall back to a synchronous read.
+ */
+int
+__wt_io_uring_read(WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_IO_REQ *req)
+{
+#ifdef HAVE_LINUX_IO_URING_H
+    struct io_uring_sqe *sqe;
+    WT_DECL_RET;
+    uint32_t idx, tail;
+    int r;
+
+    /* Bound the number of reads in flight so the completion queue can never overflow. */
+    if (__wt_atomic_addv32(&ring->inflight, 1) > ring->depth) {
+        (void)__wt_atomic_subv32(&ring->inflight, 1);
+        return (EBUSY);
+    }
+
+    __wt_spin_lock(session, &ring->sq_lock);
+    tail = *ring->sq_tail;
+    idx = tail & *ring->sq_mask;
+    sqe = &((struct io_uring_sqe *)ring->sqes)[idx];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = ((WT_FILE_HANDLE_POSIX *)req->fh->handle)->fd;
+    sqe->off = (uint64_t)req->offset;
+    sqe->addr = (uint64_t)(uintptr_t)req->buf.mem;
+    sqe->len = (uint32_t)req->len;
+    sqe->user_data = (uint64_t)(uintptr_t)req;
+    ring->sq_array[idx] = idx;
+    WT_RELEASE_WRITE(*ring->sq_tail, tail + 1);
+
+    /*
+     * The kernel only consumes submission queue entries inside io_uring_enter, if the submission
+     * fails, take the entry back. The kernel can return without consuming the entry and without an
+     * error, treat that as an I/O error so the caller falls back to a synchronous read.
+     */
+    if ((r = __uring_enter(ring->fd, 1, 0, 0)) != 1) {
+        ret = r < 0 ? __wt_errno() : EIO;
+        WT_RELEASE_WRITE(*ring->sq_tail, tail);
+    }
+    __wt_spin_unlock(session, &ring->sq_lock);
+
+    if (ret != 0) {
+        (void)__wt_atomic_subv32(&ring->inflight, 1);
+        return (ret);
+    }
+    WT_STAT_CONN_INCR(session, block_read_io_uring_submitted);
+    return (0);
+#else
+    WT_UNUSED(session);
+    WT_UNUSED(ring);
+    WT_UNUSED(req);
+    return (ENOTSUP);
+#endif
+}
+
+/*
+ * __wt_io_uring_wait --
+ *     Wait for an asynchronous read to complete.
+ */
+int
+__wt_io_uring_wait(WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_IO_REQ *req)
+{
+#ifdef HAVE_LINUX_IO_URING_H
+    WT_DECL_RET;
+    uint32_t reaped;
+    bool done;
+
+    /*
+     * Any waiting thread can reap completions for any request, so only one thread at a time drives
+     * the completion queue and blocks in the kernel. Other threads sleep until the driving thread
+     * reaps completions, then check whether their request is done or they can take over.
+     */
+    for (;;) {
+        WT_ACQUIRE_READ(done, req->done);
+        if (done)
+            break;
+        if (__wt_spin_trylock(session, &ring->cq_lock) != 0) {
+            __wt_cond_wait(session, ring->cq_cond, 10 * WT_THOUSAND, NULL);
+            continue;
+        }
+        reaped = __uring_reap(session, ring);
+        WT_ACQUIRE_READ(done, req->done);
+        if (!done && __uring_enter(ring->fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+          (ret = __wt_errno()) != EINTR && ret != EAGAIN) {
+            __wt_spin_unlock(session, &ring->cq_lock);
+            __wt_cond_signal(session, ring->cq_cond);
+            WT_RET_MSG(session, ret, "io_uring_enter");
+        }
+        ret = 0;
+        reaped += __uring_reap(session, ring);
+        __wt_spin_unlock(session, &ring->cq_lock);
+
+        /* Wake threads waiting for the reads just reaped, or to take over the completion queue. */
+        if (reaped != 0)
+            __wt_cond_signal(session, ring->cq_cond);
+    }
+    return (0);
+#else
+    WT_UNUSED(session);
+    WT_UNUSED(ring);
+    WT_UNUSED(req);
+    return (ENOTSUP);
+#endif
+}
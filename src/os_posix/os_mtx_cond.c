@@ -130,6 +130,9 @@ skipping:
         ret = 0;
     }
 
+    /* The thread may have been moved to another CPU while it slept. */
+    __wt_stats_slot_refresh(session);
+
 err:
     (void)__wt_atomic_subi32(&cond->waiters, 1);
 
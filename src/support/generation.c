@@ -26,6 +26,8 @@ static const char *
 __gen_name(int which)
 {
     switch (which) {
+    case WT_GEN_BLKCACHE:
+        return ("block cache");
     case WT_GEN_CHECKPOINT:
         return ("checkpoint");
     case WT_GEN_EVICT:
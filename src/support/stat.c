@@ -237,6 +237,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: cursor reopen calls that return an error",
   "cursor: cursor reserve calls that return an error",
   "cursor: cursor reset calls that return an error",
+  "cursor: cursor search batch calls that return an error",
   "cursor: cursor search calls that return an error",
   "cursor: cursor search near calls that return an error",
   "cursor: cursor update calls that return an error",
@@ -253,6 +254,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: remove key bytes removed",
   "cursor: reserve calls",
   "cursor: reset calls",
+  "cursor: search batch calls",
   "cursor: search calls",
   "cursor: search history store calls",
   "cursor: search near calls",
@@ -341,13 +343,22 @@ __wt_stat_dsrc_init_single(WT_DSRC_STATS *stats)
 int
 __wt_stat_dsrc_init(WT_SESSION_IMPL *session, WT_DATA_HANDLE *handle)
 {
+    size_t stride;
     int i;
+    uint8_t *p;
 
-    WT_RET(__wt_calloc(session, (size_t)WT_STAT_DSRC_COUNTER_SLOTS, sizeof(*handle->stat_array),
-      &handle->stat_array));
+    /*
+     * Start each structure on its own cache line, the last values of one structure and the first
+     * values of the next are updated by different threads. Allocate an extra line's worth so the
+     * first structure can be aligned.
+     */
+    stride = (size_t)WT_ALIGN(sizeof(*handle->stat_array), WT_CACHE_LINE_ALIGNMENT);
+    WT_RET(
+      __wt_calloc(session, (size_t)WT_STAT_DSRC_COUNTER_SLOTS + 1, stride, &handle->stat_array));
+    p = (uint8_t *)(uintptr_t)WT_ALIGN((uintptr_t)handle->stat_array, WT_CACHE_LINE_ALIGNMENT);
 
     for (i = 0; i < WT_STAT_DSRC_COUNTER_SLOTS; ++i) {
-        handle->stats[i] = &handle->stat_array[i];
+        handle->stats[i] = (void *)(p + (size_t)i * stride);
         __wt_stat_dsrc_init_single(handle->stats[i]);
     }
     return (0);
@@ -581,6 +592,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_reopen_error = 0;
     stats->cursor_reserve_error = 0;
     stats->cursor_reset_error = 0;
+    stats->cursor_search_batch_error = 0;
     stats->cursor_search_error = 0;
     stats->cursor_search_near_error = 0;
     stats->cursor_update_error = 0;
@@ -597,6 +609,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_remove_bytes = 0;
     stats->cursor_reserve = 0;
     stats->cursor_reset = 0;
+    stats->cursor_search_batch = 0;
     stats->cursor_search = 0;
     stats->cursor_search_hs = 0;
     stats->cursor_search_near = 0;
@@ -917,6 +930,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_reopen_error += from->cursor_reopen_error;
     to->cursor_reserve_error += from->cursor_reserve_error;
     to->cursor_reset_error += from->cursor_reset_error;
+    to->cursor_search_batch_error += from->cursor_search_batch_error;
     to->cursor_search_error += from->cursor_search_error;
     to->cursor_search_near_error += from->cursor_search_near_error;
     to->cursor_update_error += from->cursor_update_error;
@@ -933,6 +947,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_remove_bytes += from->cursor_remove_bytes;
     to->cursor_reserve += from->cursor_reserve;
     to->cursor_reset += from->cursor_reset;
+    to->cursor_search_batch += from->cursor_search_batch;
     to->cursor_search += from->cursor_search;
     to->cursor_search_hs += from->cursor_search_hs;
     to->cursor_search_near += from->cursor_search_near;
@@ -1274,6 +1289,7 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cursor_reopen_error += WT_STAT_DSRC_READ(from, cursor_reopen_error);
     to->cursor_reserve_error += WT_STAT_DSRC_READ(from, cursor_reserve_error);
     to->cursor_reset_error += WT_STAT_DSRC_READ(from, cursor_reset_error);
+    to->cursor_search_batch_error += WT_STAT_DSRC_READ(from, cursor_search_batch_error);
     to->cursor_search_error += WT_STAT_DSRC_READ(from, cursor_search_error);
     to->cursor_search_near_error += WT_STAT_DSRC_READ(from, cursor_search_near_error);
     to->cursor_update_error += WT_STAT_DSRC_READ(from, cursor_update_error);
@@ -1290,6 +1306,7 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cursor_remove_bytes += WT_STAT_DSRC_READ(from, cursor_remove_bytes);
     to->cursor_reserve += WT_STAT_DSRC_READ(from, cursor_reserve);
     to->cursor_reset += WT_STAT_DSRC_READ(from, cursor_reset);
+    to->cursor_search_batch += WT_STAT_DSRC_READ(from, cursor_search_batch);
     to->cursor_search += WT_STAT_DSRC_READ(from, cursor_search);
     to->cursor_search_hs += WT_STAT_DSRC_READ(from, cursor_search_hs);
     to->cursor_search_near += WT_STAT_DSRC_READ(from, cursor_search_near);
@@ -1421,8 +1438,15 @@ static const char *const __stats_connection_desc[] = {
   "block-cache: total bytes",
   "block-cache: total bytes inserted on read path",
   "block-cache: total bytes inserted on write path",
+  "block-manager: asynchronous block reads discarded without being used",
+  "block-manager: asynchronous block reads used by a block read",
+  "block-manager: asynchronous reads completed by io_uring",
+  "block-manager: asynchronous reads performed synchronously because io_uring was full or "
+  "unavailable",
+  "block-manager: asynchronous reads submitted to io_uring",
   "block-manager: blocks pre-loaded",
   "block-manager: blocks read",
+  "block-manager: blocks read by extending an adjacent asynchronous block read",
   "block-manager: blocks written",
   "block-manager: bytes read",
   "block-manager: bytes read via memory map API",
@@ -1482,6 +1506,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: eviction server skips pages that previously failed eviction and likely will again",
   "cache: eviction server skips pages that we do not want to evict",
   "cache: eviction server skips tree that we do not want to evict",
+	"cache: eviction server skips trees being walked by an eviction worker thread",
   "cache: eviction server skips trees that are being checkpointed",
   "cache: eviction server skips trees that are configured to stick in cache",
   "cache: eviction server skips trees that disable eviction",
@@ -1504,6 +1529,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: eviction walk target strategy only clean pages",
   "cache: eviction walk target strategy only dirty pages",
   "cache: eviction walks abandoned",
+	"cache: eviction walks by eviction worker threads",
   "cache: eviction walks gave up because they restarted their walk twice",
   "cache: eviction walks gave up because they saw too many pages and found no candidates",
   "cache: eviction walks gave up because they saw too many pages and found too few candidates",
@@ -1589,6 +1615,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: pages dirtied due to obsolete time window by eviction",
   "cache: pages evicted in parallel with checkpoint",
   "cache: pages queued for eviction",
+	"cache: pages queued for eviction from eviction worker thread walks",
   "cache: pages queued for eviction post lru sorting",
   "cache: pages queued for urgent eviction",
   "cache: pages queued for urgent eviction during walk",
@@ -1602,6 +1629,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: pages requested from the cache due to pre-fetch",
   "cache: pages seen by eviction walk",
   "cache: pages seen by eviction walk that are already queued",
+  "cache: pages selected for eviction by eviction worker threads from their NUMA node",
   "cache: pages selected for eviction unable to be evicted",
   "cache: pages selected for eviction unable to be evicted because of active children on an "
   "internal page",
@@ -1797,6 +1825,8 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor reserve calls that return an error",
   "cursor: cursor reset calls",
   "cursor: cursor reset calls that return an error",
+  "cursor: cursor search batch calls",
+  "cursor: cursor search batch calls that return an error",
   "cursor: cursor search calls",
   "cursor: cursor search calls that return an error",
   "cursor: cursor search history store calls",
@@ -1871,6 +1901,7 @@ static const char *const __stats_connection_desc[] = {
   "log: log server thread advances write LSN",
   "log: log server thread write LSN walk skipped",
   "log: log sync operations",
+  "log: log sync operations extended over records released by other threads",
   "log: log sync time duration (usecs)",
   "log: log sync_dir operations",
   "log: log sync_dir time duration (usecs)",
@@ -2104,6 +2135,7 @@ static const char *const __stats_connection_desc[] = {
   "transaction: transaction range of timestamps pinned by the oldest timestamp",
   "transaction: transaction read timestamp of the oldest active reader",
   "transaction: transaction rollback to stable currently running",
+  "transaction: transaction snapshots reused without a walk of concurrent sessions",
   "transaction: transaction walk of concurrent sessions",
   "transaction: transactions committed",
   "transaction: transactions rolled back",
@@ -2127,13 +2159,22 @@ __wt_stat_connection_init_single(WT_CONNECTION_STATS *stats)
 int
 __wt_stat_connection_init(WT_SESSION_IMPL *session, WT_CONNECTION_IMPL *handle)
 {
+    size_t stride;
     int i;
+    uint8_t *p;
 
-    WT_RET(__wt_calloc(session, (size_t)WT_STAT_CONN_COUNTER_SLOTS, sizeof(*handle->stat_array),
-      &handle->stat_array));
+    /*
+     * Start each structure on its own cache line, the last values of one structure and the first
+     * values of the next are updated by different threads. Allocate an extra line's worth so the
+     * first structure can be aligned.
+     */
+    stride = (size_t)WT_ALIGN(sizeof(*handle->stat_array), WT_CACHE_LINE_ALIGNMENT);
+    WT_RET(
+      __wt_calloc(session, (size_t)WT_STAT_CONN_COUNTER_SLOTS + 1, stride, &handle->stat_array));
+    p = (uint8_t *)(uintptr_t)WT_ALIGN((uintptr_t)handle->stat_array, WT_CACHE_LINE_ALIGNMENT);
 
     for (i = 0; i < WT_STAT_CONN_COUNTER_SLOTS; ++i) {
-        handle->stats[i] = &handle->stat_array[i];
+        handle->stats[i] = (void *)(p + (size_t)i * stride);
         __wt_stat_connection_init_single(handle->stats[i]);
     }
     return (0);
@@ -2203,8 +2244,14 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_cache_bytes = 0;
     stats->block_cache_bytes_insert_read = 0;
     stats->block_cache_bytes_insert_write = 0;
+    stats->block_read_async_discard = 0;
+    stats->block_read_async_hit = 0;
+    stats->block_read_io_uring_completed = 0;
+    stats->block_read_io_uring_sync = 0;
+    stats->block_read_io_uring_submitted = 0;
     stats->block_preload = 0;
     stats->block_read = 0;
+    stats->block_read_async_coalesced = 0;
     stats->block_write = 0;
     stats->block_byte_read = 0;
     stats->block_byte_read_mmap = 0;
@@ -2257,6 +2304,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->eviction_server_skip_pages_retry = 0;
     stats->eviction_server_skip_unwanted_pages = 0;
     stats->eviction_server_skip_unwanted_tree = 0;
+	stats->eviction_server_skip_trees_worker_walk = 0;
     stats->eviction_server_skip_checkpointing_trees = 0;
     stats->eviction_server_skip_trees_stick_in_cache = 0;
     stats->eviction_server_skip_trees_eviction_disabled = 0;
@@ -2279,6 +2327,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->eviction_target_strategy_clean = 0;
     stats->eviction_target_strategy_dirty = 0;
     stats->eviction_walks_abandoned = 0;
+	stats->eviction_worker_walk = 0;
     stats->eviction_walks_stopped = 0;
     stats->eviction_walks_gave_up_no_targets = 0;
     stats->eviction_walks_gave_up_ratio = 0;
@@ -2354,6 +2403,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_dirty_obsolete_tw = 0;
     stats->eviction_pages_in_parallel_with_checkpoint = 0;
     stats->eviction_pages_ordinary_queued = 0;
+	stats->eviction_worker_walk_pages_merged = 0;
     stats->eviction_pages_queued_post_lru = 0;
     stats->eviction_pages_queued_urgent = 0;
     stats->eviction_pages_queued_oldest = 0;
@@ -2367,6 +2417,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_pages_prefetch = 0;
     stats->cache_eviction_pages_seen = 0;
     stats->eviction_pages_already_queued = 0;
+    stats->eviction_worker_numa_local = 0;
     stats->eviction_fail = 0;
     stats->eviction_fail_active_children_on_an_internal_page = 0;
     stats->eviction_fail_in_reconciliation = 0;
@@ -2558,6 +2609,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_reserve_error = 0;
     stats->cursor_reset = 0;
     stats->cursor_reset_error = 0;
+    stats->cursor_search_batch = 0;
+    stats->cursor_search_batch_error = 0;
     stats->cursor_search = 0;
     stats->cursor_search_error = 0;
     stats->cursor_search_hs = 0;
@@ -2632,6 +2685,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_write_lsn = 0;
     stats->log_write_lsn_skip = 0;
     stats->log_sync = 0;
+    stats->log_sync_group = 0;
     /* not clearing log_sync_duration */
     stats->log_sync_dir = 0;
     /* not clearing log_sync_dir_duration */
@@ -2857,6 +2911,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing txn_pinned_timestamp_oldest */
     /* not clearing txn_timestamp_oldest_active_read */
     /* not clearing txn_rollback_to_stable_running */
+    stats->txn_snapshot_cache_hit = 0;
     stats->txn_walk_sessions = 0;
     stats->txn_commit = 0;
     stats->txn_rollback = 0;
@@ -2938,8 +2993,14 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_cache_bytes += WT_STAT_CONN_READ(from, block_cache_bytes);
     to->block_cache_bytes_insert_read += WT_STAT_CONN_READ(from, block_cache_bytes_insert_read);
     to->block_cache_bytes_insert_write += WT_STAT_CONN_READ(from, block_cache_bytes_insert_write);
+    to->block_read_async_discard += WT_STAT_CONN_READ(from, block_read_async_discard);
+    to->block_read_async_hit += WT_STAT_CONN_READ(from, block_read_async_hit);
+    to->block_read_io_uring_completed += WT_STAT_CONN_READ(from, block_read_io_uring_completed);
+    to->block_read_io_uring_sync += WT_STAT_CONN_READ(from, block_read_io_uring_sync);
+    to->block_read_io_uring_submitted += WT_STAT_CONN_READ(from, block_read_io_uring_submitted);
     to->block_preload += WT_STAT_CONN_READ(from, block_preload);
     to->block_read += WT_STAT_CONN_READ(from, block_read);
+    to->block_read_async_coalesced += WT_STAT_CONN_READ(from, block_read_async_coalesced);
     to->block_write += WT_STAT_CONN_READ(from, block_write);
     to->block_byte_read += WT_STAT_CONN_READ(from, block_byte_read);
     to->block_byte_read_mmap += WT_STAT_CONN_READ(from, block_byte_read_mmap);
@@ -3007,6 +3068,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, eviction_server_skip_unwanted_pages);
     to->eviction_server_skip_unwanted_tree +=
       WT_STAT_CONN_READ(from, eviction_server_skip_unwanted_tree);
+	to->eviction_server_skip_trees_worker_walk +=
+	    WT_STAT_CONN_READ(from, eviction_server_skip_trees_worker_walk);
     to->eviction_server_skip_checkpointing_trees +=
       WT_STAT_CONN_READ(from, eviction_server_skip_checkpointing_trees);
     to->eviction_server_skip_trees_stick_in_cache +=
@@ -3038,6 +3101,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->eviction_target_strategy_clean += WT_STAT_CONN_READ(from, eviction_target_strategy_clean);
     to->eviction_target_strategy_dirty += WT_STAT_CONN_READ(from, eviction_target_strategy_dirty);
     to->eviction_walks_abandoned += WT_STAT_CONN_READ(from, eviction_walks_abandoned);
+    to->eviction_worker_walk += WT_STAT_CONN_READ(from, eviction_worker_walk);
     to->eviction_walks_stopped += WT_STAT_CONN_READ(from, eviction_walks_stopped);
     to->eviction_walks_gave_up_no_targets +=
       WT_STAT_CONN_READ(from, eviction_walks_gave_up_no_targets);
@@ -3129,6 +3193,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->eviction_pages_in_parallel_with_checkpoint +=
       WT_STAT_CONN_READ(from, eviction_pages_in_parallel_with_checkpoint);
     to->eviction_pages_ordinary_queued += WT_STAT_CONN_READ(from, eviction_pages_ordinary_queued);
+    to->eviction_worker_walk_pages_merged +=
+      WT_STAT_CONN_READ(from, eviction_worker_walk_pages_merged);
     to->eviction_pages_queued_post_lru += WT_STAT_CONN_READ(from, eviction_pages_queued_post_lru);
     to->eviction_pages_queued_urgent += WT_STAT_CONN_READ(from, eviction_pages_queued_urgent);
     to->eviction_pages_queued_oldest += WT_STAT_CONN_READ(from, eviction_pages_queued_oldest);
@@ -3143,6 +3209,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_pages_prefetch += WT_STAT_CONN_READ(from, cache_pages_prefetch);
     to->cache_eviction_pages_seen += WT_STAT_CONN_READ(from, cache_eviction_pages_seen);
     to->eviction_pages_already_queued += WT_STAT_CONN_READ(from, eviction_pages_already_queued);
+    to->eviction_worker_numa_local += WT_STAT_CONN_READ(from, eviction_worker_numa_local);
     to->eviction_fail += WT_STAT_CONN_READ(from, eviction_fail);
     to->eviction_fail_active_children_on_an_internal_page +=
       WT_STAT_CONN_READ(from, eviction_fail_active_children_on_an_internal_page);
@@ -3360,6 +3427,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cursor_reserve_error += WT_STAT_CONN_READ(from, cursor_reserve_error);
     to->cursor_reset += WT_STAT_CONN_READ(from, cursor_reset);
     to->cursor_reset_error += WT_STAT_CONN_READ(from, cursor_reset_error);
+    to->cursor_search_batch += WT_STAT_CONN_READ(from, cursor_search_batch);
+    to->cursor_search_batch_error += WT_STAT_CONN_READ(from, cursor_search_batch_error);
     to->cursor_search += WT_STAT_CONN_READ(from, cursor_search);
     to->cursor_search_error += WT_STAT_CONN_READ(from, cursor_search_error);
     to->cursor_search_hs += WT_STAT_CONN_READ(from, cursor_search_hs);
@@ -3438,6 +3507,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->log_write_lsn += WT_STAT_CONN_READ(from, log_write_lsn);
     to->log_write_lsn_skip += WT_STAT_CONN_READ(from, log_write_lsn_skip);
     to->log_sync += WT_STAT_CONN_READ(from, log_sync);
+    to->log_sync_group += WT_STAT_CONN_READ(from, log_sync_group);
     to->log_sync_duration += WT_STAT_CONN_READ(from, log_sync_duration);
     to->log_sync_dir += WT_STAT_CONN_READ(from, log_sync_dir);
     to->log_sync_dir_duration += WT_STAT_CONN_READ(from, log_sync_dir_duration);
@@ -3698,6 +3768,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->txn_timestamp_oldest_active_read +=
       WT_STAT_CONN_READ(from, txn_timestamp_oldest_active_read);
     to->txn_rollback_to_stable_running += WT_STAT_CONN_READ(from, txn_rollback_to_stable_running);
+    to->txn_snapshot_cache_hit += WT_STAT_CONN_READ(from, txn_snapshot_cache_hit);
     to->txn_walk_sessions += WT_STAT_CONN_READ(from, txn_walk_sessions);
     to->txn_commit += WT_STAT_CONN_READ(from, txn_commit);
     to->txn_rollback += WT_STAT_CONN_READ(from, txn_rollback);
@@ -28,6 +28,8 @@ __thread_run(void *arg)
         if (!F_ISSET(thread, WT_THREAD_ACTIVE))
             __wt_cond_wait(
               session, thread->pause_cond, WT_THREAD_PAUSE * WT_MILLION, thread->chk_func);
+        /* Internal threads don't make API calls, choose their statistics slots here. */
+        __wt_stats_slot_refresh(session);
         WT_ERR(thread->run_func(session, thread));
     }
 
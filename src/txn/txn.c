@@ -86,6 +86,7 @@ __txn_remove_from_global_table(WT_SESSION_IMPL *session)
     txn_shared = WT_SESSION_TXN_SHARED(session);
 #endif
     WT_RELEASE_WRITE_WITH_BARRIER(txn_shared->id, WT_TXN_NONE);
+    (void)__wt_atomic_addv64(&S2C(session)->txn_global.txn_release_gen, 1);
 }
 
 /*
@@ -138,7 +139,7 @@ __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
     F_CLR(txn, WT_TXN_HAS_SNAPSHOT);
 
     /* Clear a checkpoint's pinned ID and timestamp. */
-    if (WT_SESSION_IS_CHECKPOINT(session)) {
+    if (WT_SESSION_IS_CHECKPOINT_TXN(session)) {
         __wt_atomic_storev64(&txn_global->checkpoint_txn_shared.pinned_id, WT_TXN_NONE);
         txn_global->checkpoint_timestamp = WT_TS_NONE;
     }
@@ -194,6 +195,86 @@ done:
     return (active);
 }
 
+/*
+ * __txn_snapshot_cache_get --
+ *     Copy the cached set of concurrent transaction IDs into our snapshot if it was taken with the
+ *     same current ID and release generation, returning true on success.
+ */
+static bool
+__txn_snapshot_cache_get(WT_SESSION_IMPL *session, uint64_t current_id, uint64_t release_gen,
+  uint64_t prev_oldest_id, uint32_t *np, uint64_t *pinned_idp)
+{
+    WT_TXN *txn;
+    WT_TXN_GLOBAL *txn_global;
+    uint64_t pinned_id, seq;
+    uint32_t count;
+
+    txn = session->txn;
+    txn_global = &S2C(session)->txn_global;
+
+    WT_ACQUIRE_READ(seq, txn_global->snapshot_cache_seq);
+    if ((seq & 1) != 0 || txn_global->snapshot_cache_current != current_id ||
+      txn_global->snapshot_cache_release_gen != release_gen)
+        return (false);
+
+    /* The count may be torn by a concurrent publisher: bound it before copying. */
+    count = txn_global->snapshot_cache_count;
+    if (count > S2C(session)->session_array.size - *np)
+        return (false);
+    pinned_id = txn_global->snapshot_cache_pinned;
+    if (count != 0)
+        memcpy(txn->snapshot_data.snapshot + *np, txn_global->snapshot_cache,
+          count * sizeof(uint64_t));
+
+    /* Discard the copy if a publisher started rewriting the cache while we read it. */
+    WT_ACQUIRE_BARRIER();
+    if (__wt_atomic_loadv64(&txn_global->snapshot_cache_seq) != seq)
+        return (false);
+
+    /*
+     * An ID older than the oldest ID we saw belongs to a thread racing to allocate: the walk would
+     * skip it, go the slow way rather than pin below the oldest ID.
+     */
+    if (WT_TXNID_LT(pinned_id, prev_oldest_id))
+        return (false);
+
+    *np += count;
+    *pinned_idp = pinned_id;
+    return (true);
+}
+
+/*
+ * __txn_snapshot_cache_put --
+ *     Publish the concurrent transaction IDs found by a walk of the shared list. Give up if another
+ *     thread is publishing, the next walk will try again.
+ */
+static void
+__txn_snapshot_cache_put(WT_SESSION_IMPL *session, uint64_t current_id, uint64_t release_gen,
+  const uint64_t *ids, uint32_t count, uint64_t pinned_id)
+{
+    WT_TXN_GLOBAL *txn_global;
+    uint64_t seq;
+
+    txn_global = &S2C(session)->txn_global;
+
+    if (__wt_spin_trylock(session, &txn_global->snapshot_cache_lock) != 0)
+        return;
+
+    seq = __wt_atomic_loadv64(&txn_global->snapshot_cache_seq);
+    __wt_atomic_storev64(&txn_global->snapshot_cache_seq, seq + 1);
+    WT_RELEASE_BARRIER();
+
+    txn_global->snapshot_cache_current = current_id;
+    txn_global->snapshot_cache_release_gen = release_gen;
+    txn_global->snapshot_cache_pinned = pinned_id;
+    txn_global->snapshot_cache_count = count;
+    if (count != 0)
+        memcpy(txn_global->snapshot_cache, ids, count * sizeof(uint64_t));
+
+    WT_RELEASE_WRITE(txn_global->snapshot_cache_seq, seq + 2);
+    __wt_spin_unlock(session, &txn_global->snapshot_cache_lock);
+}
+
 /*
  * __txn_get_snapshot_int --
  *     Allocate a snapshot, optionally update our shared txn ids.
@@ -205,8 +286,9 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
     WT_TXN *txn;
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_SHARED *s, *txn_shared;
-    uint64_t current_id, id, pinned_id, prev_oldest_id, snapshot_gen;
-    uint32_t i, n, session_cnt;
+    uint64_t current_id, id, pinned_id, prev_oldest_id, release_gen, snapshot_gen;
+    uint32_t i, n, scan_start, session_cnt;
+    bool use_cache;
 
     conn = S2C(session);
     txn = session->txn;
@@ -256,6 +338,22 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
         goto done;
     }
 
+    /*
+     * Without an ID of our own, the set of concurrent transactions only depends on which IDs have
+     * been allocated and released: if neither has happened since the last walk, reuse its result.
+     */
+    release_gen = 0;
+    scan_start = n;
+    use_cache = txn->id == WT_TXN_NONE;
+    if (use_cache) {
+        WT_ACQUIRE_READ(release_gen, txn_global->txn_release_gen);
+        if (__txn_snapshot_cache_get(
+              session, current_id, release_gen, prev_oldest_id, &n, &pinned_id)) {
+            WT_STAT_CONN_INCR(session, txn_snapshot_cache_hit);
+            goto done;
+        }
+    }
+
     /* Walk the array of concurrent transactions. */
     WT_ACQUIRE_READ_WITH_BARRIER(session_cnt, conn->session_array.cnt);
     WT_STAT_CONN_INCR(session, txn_walk_sessions);
@@ -301,6 +399,15 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
     }
     WT_STAT_CONN_INCRV(session, txn_sessions_walked, i);
 
+    /* Share the walk if no ID was allocated or released while we were scanning. */
+    if (use_cache) {
+        WT_ACQUIRE_BARRIER();
+        if (__wt_atomic_loadv64(&txn_global->current) == current_id &&
+          __wt_atomic_loadv64(&txn_global->txn_release_gen) == release_gen)
+            __txn_snapshot_cache_put(session, current_id, release_gen,
+              txn->snapshot_data.snapshot + scan_start, n - scan_start, pinned_id);
+    }
+
     /*
      * If we got a new snapshot, update the published pinned ID for this session.
      */
@@ -392,6 +499,67 @@ __wt_txn_snapshot_release_and_restore(WT_SESSION_IMPL *session)
     __wt_free(session, snapshot_backup);
 }
 
+/*
+ * __wt_txn_snapshot_borrow --
+ *     Run a session under a copy of another transaction's snapshot and read timestamp. The snapshot
+ *     isn't published: the owning transaction keeps the snapshot's updates pinned and must stay
+ *     running, with its snapshot and read timestamp unchanged, until the copy is released.
+ */
+void
+__wt_txn_snapshot_borrow(
+  WT_SESSION_IMPL *session, const WT_TXN_SNAPSHOT *snapshot, wt_timestamp_t read_ts)
+{
+    WT_TXN *txn;
+    WT_TXN_SHARED *txn_shared;
+
+    txn = session->txn;
+    txn_shared = WT_SESSION_TXN_SHARED(session);
+
+    WT_ASSERT(session, !F_ISSET(txn, WT_TXN_HAS_SNAPSHOT) && !F_ISSET(txn, WT_TXN_RUNNING));
+    WT_ASSERT(session, !F_ISSET(txn, WT_TXN_SHARED_TS_READ));
+
+    txn->snapshot_data.snap_max = snapshot->snap_max;
+    txn->snapshot_data.snap_min = snapshot->snap_min;
+    txn->snapshot_data.snapshot_count = snapshot->snapshot_count;
+    if (snapshot->snapshot_count != 0)
+        memcpy(txn->snapshot_data.snapshot, snapshot->snapshot,
+          snapshot->snapshot_count * sizeof(snapshot->snapshot[0]));
+
+    /*
+     * The owner's read timestamp is already published, so the pinned timestamp can't move past it:
+     * publishing the same timestamp again needs no lock.
+     */
+    if (read_ts != WT_TS_NONE) {
+        txn_shared->read_timestamp = read_ts;
+        WT_RELEASE_BARRIER();
+        F_SET(txn, WT_TXN_SHARED_TS_READ);
+    }
+
+    /*
+     * Mark the transaction running, otherwise releasing the last page would discard the snapshot.
+     */
+    txn->isolation = WT_ISO_SNAPSHOT;
+    F_SET(txn, WT_TXN_HAS_SNAPSHOT | WT_TXN_RUNNING);
+}
+
+/*
+ * __wt_txn_snapshot_borrow_end --
+ *     Stop running under a borrowed snapshot.
+ */
+void
+__wt_txn_snapshot_borrow_end(WT_SESSION_IMPL *session)
+{
+    WT_TXN *txn;
+
+    txn = session->txn;
+
+    WT_ASSERT(session, txn->id == WT_TXN_NONE && txn->mod_count == 0);
+
+    __wti_txn_clear_read_timestamp(session);
+    F_CLR(txn, WT_TXN_HAS_SNAPSHOT | WT_TXN_RUNNING);
+    txn->isolation = session->isolation;
+}
+
 /*
  * __txn_oldest_scan --
  *     Sweep the running transactions to calculate the oldest ID required.
@@ -786,7 +954,7 @@ __txn_release(WT_SESSION_IMPL *session)
     WT_ASSERT(session, txn->mod_count == 0);
 
     /* Clear the transaction's ID from the global table. */
-    if (WT_SESSION_IS_CHECKPOINT(session)) {
+    if (WT_SESSION_IS_CHECKPOINT_TXN(session)) {
         WT_ASSERT(session, __wt_atomic_loadv64(&WT_SESSION_TXN_SHARED(session)->id) == WT_TXN_NONE);
         txn->id = WT_TXN_NONE;
         __wt_atomic_storev64(&txn_global->checkpoint_txn_shared.id, WT_TXN_NONE);
@@ -2529,6 +2697,9 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
 
     WT_RET(__wt_calloc_def(session, conn->session_array.size, &txn_global->txn_shared_list));
 
+    WT_RET(__wt_spin_init(session, &txn_global->snapshot_cache_lock, "snapshot cache"));
+    WT_RET(__wt_calloc_def(session, conn->session_array.size, &txn_global->snapshot_cache));
+
     for (i = 0, s = txn_global->txn_shared_list; i < conn->session_array.size; i++, s++) {
         __wt_atomic_storev64(&s->id, WT_TXN_NONE);
         __wt_atomic_storev64(&s->pinned_id, WT_TXN_NONE);
@@ -2557,6 +2728,8 @@ __wt_txn_global_destroy(WT_SESSION_IMPL *session)
     __wt_rwlock_destroy(session, &txn_global->rwlock);
     __wt_rwlock_destroy(session, &txn_global->visibility_rwlock);
     __wt_free(session, txn_global->txn_shared_list);
+    __wt_spin_destroy(session, &txn_global->snapshot_cache_lock);
+    __wt_free(session, txn_global->snapshot_cache);
 }
 
 /*
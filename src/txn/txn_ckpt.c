@@ -8,6 +8,8 @@
 
 #include "wt_internal.h"
 
+static int __checkpoint_apply_trees_parallel(WT_SESSION_IMPL *);
+static int __checkpoint_threads_config(WT_SESSION_IMPL *, uint32_t);
 static void __checkpoint_timing_stress(WT_SESSION_IMPL *, uint64_t, struct timespec *);
 static int __checkpoint_lock_dirty_tree(WT_SESSION_IMPL *, bool, bool, bool, const char *[]);
 static int __checkpoint_mark_skip(WT_SESSION_IMPL *, WT_CKPT *, bool);
@@ -620,12 +622,13 @@ __checkpoint_prepare_progress(WT_SESSION_IMPL *session, bool final)
     /* Time since the full database checkpoint started */
     time_diff = WT_TIMEDIFF_SEC(cur_time, conn->ckpt_timer_start);
 
-    if (final || (time_diff / WT_PROGRESS_MSG_PERIOD) > conn->ckpt_progress_msg_count) {
+    if (final ||
+      (time_diff / WT_PROGRESS_MSG_PERIOD) > __wt_atomic_load64(&conn->ckpt_progress_msg_count)) {
         __wt_verbose_info(session, WT_VERB_CHECKPOINT_PROGRESS,
           "Checkpoint prepare %s for %" PRIu64 " seconds and it has gathered %" PRIu64
           " dhandles and skipped %" PRIu64 " dhandles",
           final ? "ran" : "has been running", time_diff, conn->ckpt_apply, conn->ckpt_skip);
-        conn->ckpt_progress_msg_count++;
+        (void)__wt_atomic_add64(&conn->ckpt_progress_msg_count, 1);
     }
 }
 
@@ -638,7 +641,7 @@ __wt_checkpoint_progress(WT_SESSION_IMPL *session, bool closing)
 {
     struct timespec cur_time;
     WT_CONNECTION_IMPL *conn;
-    uint64_t time_diff;
+    uint64_t msg_count, time_diff;
 
     conn = S2C(session);
     __wt_epoch(session, &cur_time);
@@ -646,12 +649,21 @@ __wt_checkpoint_progress(WT_SESSION_IMPL *session, bool closing)
     /* Time since the full database checkpoint started */
     time_diff = WT_TIMEDIFF_SEC(cur_time, conn->ckpt_timer_start);
 
-    if (closing || (time_diff / WT_PROGRESS_MSG_PERIOD) > conn->ckpt_progress_msg_count) {
+    /*
+     * Threads writing trees for the checkpoint report progress concurrently, only one of them
+     * outputs each periodic message.
+     */
+    msg_count = __wt_atomic_load64(&conn->ckpt_progress_msg_count);
+    if (closing ||
+      ((time_diff / WT_PROGRESS_MSG_PERIOD) > msg_count &&
+        __wt_atomic_cas64(&conn->ckpt_progress_msg_count, msg_count, msg_count + 1))) {
         __wt_verbose_info(session, WT_VERB_CHECKPOINT_PROGRESS,
           "Checkpoint %s for %" PRIu64 " seconds and wrote: %" PRIu64 " pages (%" PRIu64 " MB)",
-          closing ? "ran" : "has been running", time_diff, conn->ckpt_write_pages,
-          conn->ckpt_write_bytes / WT_MEGABYTE);
-        conn->ckpt_progress_msg_count++;
+          closing ? "ran" : "has been running", time_diff,
+          __wt_atomic_load64(&conn->ckpt_write_pages),
+          __wt_atomic_load64(&conn->ckpt_write_bytes) / WT_MEGABYTE);
+        if (closing)
+            (void)__wt_atomic_add64(&conn->ckpt_progress_msg_count, 1);
     }
 }
 
@@ -669,7 +681,7 @@ __checkpoint_stats(WT_SESSION_IMPL *session)
     conn = S2C(session);
 
     /* Output a verbose progress message for long running checkpoints. */
-    if (conn->ckpt_progress_msg_count > 0)
+    if (__wt_atomic_load64(&conn->ckpt_progress_msg_count) > 0)
         __wt_checkpoint_progress(session, true);
 
     /* Compute end-to-end timer statistics for checkpoint. */
@@ -844,6 +856,7 @@ __checkpoint_prepare(WT_SESSION_IMPL *session, bool *trackingp, const char *cfg[
     __wt_atomic_storev64(&txn_shared->id, WT_TXN_NONE);
     __wt_atomic_storev64(&txn_shared->pinned_id, WT_TXN_NONE);
     __wt_atomic_storev64(&txn_shared->metadata_pinned, WT_TXN_NONE);
+    (void)__wt_atomic_addv64(&txn_global->txn_release_gen, 1);
 
     /*
      * Set the checkpoint transaction's timestamp, if requested.
@@ -1117,6 +1130,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     uint64_t ckpt_tree_duration_usecs, fsync_duration_usecs, generation, hs_ckpt_duration_usecs;
     uint64_t time_start_ckpt_tree, time_start_fsync, time_start_hs, time_stop_ckpt_tree,
       time_stop_fsync, time_stop_hs;
+    uint32_t ckpt_threads;
     u_int i;
     const char *name;
     bool can_skip, failed, full, idle, logging, tracking, use_timestamp;
@@ -1171,9 +1185,9 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     __wt_epoch(session, &conn->ckpt_timer_start);
 
     /* Initialize the checkpoint progress tracking data */
-    conn->ckpt_progress_msg_count = 0;
-    conn->ckpt_write_bytes = 0;
-    conn->ckpt_write_pages = 0;
+    __wt_atomic_store64(&conn->ckpt_progress_msg_count, 0);
+    __wt_atomic_store64(&conn->ckpt_write_bytes, 0);
+    __wt_atomic_store64(&conn->ckpt_write_pages, 0);
 
     /*
      * Get a time (wall time, not a timestamp) for this checkpoint. This will be applied to all the
@@ -1239,7 +1253,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     WT_ERR(ret);
 
     /* Log the final checkpoint prepare progress message if needed. */
-    if (conn->ckpt_progress_msg_count > 0)
+    if (__wt_atomic_load64(&conn->ckpt_progress_msg_count) > 0)
         __checkpoint_prepare_progress(session, true);
 
     /*
@@ -1271,7 +1285,12 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     __checkpoint_verbose_track(session, "checkpointing individual trees");
 
     time_start_ckpt_tree = __wt_clock(session);
-    WT_ERR(__checkpoint_apply_to_dhandles(session, cfg, __checkpoint_tree_helper));
+    ckpt_threads = __wt_atomic_load32(&conn->ckpt_threads);
+    WT_ERR(__checkpoint_threads_config(session, ckpt_threads));
+    if (ckpt_threads == 0)
+        WT_ERR(__checkpoint_apply_to_dhandles(session, cfg, __checkpoint_tree_helper));
+    else
+        WT_ERR(__checkpoint_apply_trees_parallel(session));
     time_stop_ckpt_tree = __wt_clock(session);
     ckpt_tree_duration_usecs = WT_CLOCKDIFF_US(time_stop_ckpt_tree, time_start_ckpt_tree);
     WT_STAT_CONN_SET(session, checkpoint_tree_duration, ckpt_tree_duration_usecs);
@@ -2344,29 +2363,22 @@ err:
 }
 
 /*
- * __checkpoint_tree --
- *     Checkpoint a single tree. Assumes all necessary locks have been acquired by the caller.
+ * __checkpoint_tree_start --
+ *     Start the checkpoint of a single tree, up to writing it. Assumes all necessary locks have
+ *     been acquired by the caller.
  */
 static int
-__checkpoint_tree(WT_SESSION_IMPL *session, bool is_checkpoint, const char *cfg[])
+__checkpoint_tree_start(WT_SESSION_IMPL *session, bool is_checkpoint, WT_CHECKPOINT_WORK_UNIT *unit)
 {
     WT_BM *bm;
     WT_BTREE *btree;
     WT_CONNECTION_IMPL *conn;
-    WT_DATA_HANDLE *dhandle;
-    WT_DECL_ITEM(ckptlsn_str);
-    WT_DECL_RET;
-    WT_LSN ckptlsn;
     WT_TIME_AGGREGATE ta;
-    bool fake_ckpt, resolve_bm;
-
-    WT_UNUSED(cfg);
 
     btree = S2BT(session);
     bm = btree->bm;
     conn = S2C(session);
-    dhandle = session->dhandle;
-    fake_ckpt = resolve_bm = false;
+    unit->dhandle = session->dhandle;
     WT_TIME_AGGREGATE_INIT(&ta);
 
     /*
@@ -2374,7 +2386,7 @@ __checkpoint_tree(WT_SESSION_IMPL *session, bool is_checkpoint, const char *cfg[
      * roll old changes forward over the non-logged changes in this checkpoint. If logging is
      * enabled, a real checkpoint LSN will be assigned for this checkpoint and overwrite this.
      */
-    WT_MAX_LSN(&ckptlsn);
+    WT_MAX_LSN(&unit->ckptlsn);
 
     /*
      * If an object has never been used (in other words, if it could become a bulk-loaded file),
@@ -2390,8 +2402,8 @@ __checkpoint_tree(WT_SESSION_IMPL *session, bool is_checkpoint, const char *cfg[
     if (is_checkpoint && btree->original) {
         __wt_checkpoint_tree_reconcile_update(session, &ta);
 
-        fake_ckpt = true;
-        goto fake;
+        unit->fake_ckpt = true;
+        return (0);
     }
 
     /*
@@ -2405,7 +2417,7 @@ __checkpoint_tree(WT_SESSION_IMPL *session, bool is_checkpoint, const char *cfg[
      * this call. Also, marking the btree dirty at this stage will unnecessarily mark the connection
      * as dirty causing checkpoint-skip code to fail.
      */
-    WT_ERR(__wt_page_modify_init(session, btree->root.page));
+    WT_RET(__wt_page_modify_init(session, btree->root.page));
     __wt_page_only_modify_set(session, btree->root.page);
 
     /*
@@ -2420,30 +2432,64 @@ __checkpoint_tree(WT_SESSION_IMPL *session, bool is_checkpoint, const char *cfg[
 
     /* Tell logging that a file checkpoint is starting. */
     if (F_ISSET(&conn->log_mgr, WT_LOG_ENABLED))
-        WT_ERR(__wt_txn_checkpoint_log(session, false, WT_TXN_LOG_CKPT_START, &ckptlsn));
+        WT_RET(__wt_txn_checkpoint_log(session, false, WT_TXN_LOG_CKPT_START, &unit->ckptlsn));
 
     /* Tell the block manager that a file checkpoint is starting. */
-    WT_ERR(bm->checkpoint_start(bm, session));
-    resolve_bm = true;
+    WT_RET(bm->checkpoint_start(bm, session));
+    unit->resolve_bm = true;
+
+    return (0);
+}
 
-    /* Flush the file from the cache, creating the checkpoint. */
+/*
+ * __checkpoint_tree_write --
+ *     Flush a single tree from the cache, creating the checkpoint. This is the expensive part of a
+ *     tree's checkpoint, and may run in a session other than the one that started the checkpoint.
+ */
+static int
+__checkpoint_tree_write(WT_SESSION_IMPL *session, bool is_checkpoint)
+{
     if (is_checkpoint) {
-        if (WT_SESSION_IS_CHECKPOINT(session))
+        if (WT_SESSION_IS_CHECKPOINT_TXN(session))
             WT_STAT_CONN_SET(session, checkpoint_state, WT_CHECKPOINT_STATE_SYNC_FILE);
-        WT_ERR(__wt_sync_file(session, WT_SYNC_CHECKPOINT));
-    } else {
-        if (WT_SESSION_IS_CHECKPOINT(session))
-            WT_STAT_CONN_SET(session, checkpoint_state, WT_CHECKPOINT_STATE_EVICT_FILE);
-        WT_ERR(__wt_evict_file(session, WT_SYNC_CLOSE));
+        return (__wt_sync_file(session, WT_SYNC_CHECKPOINT));
     }
 
-fake:
+    if (WT_SESSION_IS_CHECKPOINT_TXN(session))
+        WT_STAT_CONN_SET(session, checkpoint_state, WT_CHECKPOINT_STATE_EVICT_FILE);
+    return (__wt_evict_file(session, WT_SYNC_CLOSE));
+}
+
+/*
+ * __checkpoint_tree_finish --
+ *     Finish the checkpoint of a single tree once it has been written, updating its metadata. If
+ *     the checkpoint of the tree has already failed, clean up after it instead.
+ */
+static int
+__checkpoint_tree_finish(
+  WT_SESSION_IMPL *session, bool is_checkpoint, WT_CHECKPOINT_WORK_UNIT *unit, int error)
+{
+    WT_BM *bm;
+    WT_BTREE *btree;
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_ITEM(ckptlsn_str);
+    WT_DECL_RET;
+
+    btree = S2BT(session);
+    bm = btree->bm;
+    conn = S2C(session);
+    dhandle = session->dhandle;
+
+    WT_ASSERT(session, unit->dhandle == dhandle);
+    WT_ERR(error);
+
     /*
      * If we're faking a checkpoint and logging is enabled, recovery should roll forward any changes
      * made between now and the next checkpoint, so set the checkpoint LSN to the beginning of time.
      */
-    if (fake_ckpt && F_ISSET(&conn->log_mgr, WT_LOG_ENABLED))
-        WT_INIT_LSN(&ckptlsn);
+    if (unit->fake_ckpt && F_ISSET(&conn->log_mgr, WT_LOG_ENABLED))
+        WT_INIT_LSN(&unit->ckptlsn);
 
     /*
      * Update the object's metadata.
@@ -2461,7 +2507,7 @@ fake:
         WT_ERR(__wt_checkpoint_sync(session, NULL));
 
     WT_ERR(__wt_scr_alloc(session, 0, &ckptlsn_str));
-    WT_ERR(__wt_lsn_string(session, &ckptlsn, ckptlsn_str));
+    WT_ERR(__wt_lsn_string(session, &unit->ckptlsn, ckptlsn_str));
     WT_ERR(__wt_meta_ckptlist_set(session, dhandle, btree->ckpt, ckptlsn_str));
 
     /*
@@ -2470,8 +2516,8 @@ fake:
      * being discarded, in which case the handle will be gone by the time we try to apply or unroll
      * the meta tracking event.
      */
-    if (!fake_ckpt) {
-        resolve_bm = false;
+    if (!unit->fake_ckpt) {
+        unit->resolve_bm = false;
         if (WT_SESSION_IS_CHECKPOINT(session))
             WT_STAT_CONN_SET(session, checkpoint_state, WT_CHECKPOINT_STATE_RESOLVE);
         if (WT_META_TRACKING(session) && is_checkpoint)
@@ -2488,8 +2534,10 @@ err:
     __wt_scr_free(session, &ckptlsn_str);
 
     /* Resolved the checkpoint for the block manager in the error path. */
-    if (resolve_bm)
+    if (unit->resolve_bm) {
+        unit->resolve_bm = false;
         WT_TRET(bm->checkpoint_resolve(bm, session, ret != 0));
+    }
 
     /*
      * If the checkpoint didn't complete successfully, make sure the tree is marked dirty.
@@ -2514,6 +2562,24 @@ err:
     return (ret);
 }
 
+/*
+ * __checkpoint_tree --
+ *     Checkpoint a single tree. Assumes all necessary locks have been acquired by the caller.
+ */
+static int
+__checkpoint_tree(WT_SESSION_IMPL *session, bool is_checkpoint, const char *cfg[])
+{
+    WT_CHECKPOINT_WORK_UNIT unit;
+    WT_DECL_RET;
+
+    WT_UNUSED(cfg);
+
+    WT_CLEAR(unit);
+    if ((ret = __checkpoint_tree_start(session, is_checkpoint, &unit)) == 0 && !unit.fake_ckpt)
+        ret = __checkpoint_tree_write(session, is_checkpoint);
+    return (__checkpoint_tree_finish(session, is_checkpoint, &unit, ret));
+}
+
 /*
  * __checkpoint_presync --
  *     Visit all handles after the checkpoint writes are complete and before syncing. At this point,
@@ -2535,38 +2601,30 @@ __checkpoint_presync(WT_SESSION_IMPL *session, const char *cfg[])
 }
 
 /*
- * __checkpoint_tree_helper --
- *     Checkpoint a tree (suitable for use in *_apply functions).
+ * __checkpoint_tree_handle_stress --
+ *     Simulate checkpoint slowness for every handle.
  */
-static int
-__checkpoint_tree_helper(WT_SESSION_IMPL *session, const char *cfg[])
+static void
+__checkpoint_tree_handle_stress(WT_SESSION_IMPL *session)
 {
     struct timespec tsp;
-    WT_BTREE *btree;
-    WT_DECL_RET;
-    WT_TXN *txn;
-    bool with_timestamp;
-
-    btree = S2BT(session);
-    txn = session->txn;
 
     /* Add a two seconds wait to simulate checkpoint slowness for every handle. */
     tsp.tv_sec = 2;
     tsp.tv_nsec = 0;
     __checkpoint_timing_stress(session, WT_TIMING_STRESS_CHECKPOINT_HANDLE, &tsp);
+}
 
-    /* Are we using a read timestamp for this checkpoint transaction? */
-    with_timestamp = F_ISSET(txn, WT_TXN_SHARED_TS_READ);
-
-    /* Logged tables ignore any read timestamp configured for the checkpoint. */
-    if (F_ISSET(btree, WT_BTREE_LOGGED))
-        F_CLR(txn, WT_TXN_SHARED_TS_READ);
-
-    ret = __checkpoint_tree(session, true, cfg);
+/*
+ * __checkpoint_tree_done --
+ *     Release a tree the checkpoint has finished with, whether or not its checkpoint succeeded.
+ */
+static void
+__checkpoint_tree_done(WT_SESSION_IMPL *session)
+{
+    WT_BTREE *btree;
 
-    /* Restore the use of the timestamp for other tables. */
-    if (with_timestamp)
-        F_SET(txn, WT_TXN_SHARED_TS_READ);
+    btree = S2BT(session);
 
     /*
      * Whatever happened, we aren't visiting this tree again in this checkpoint. Don't keep updates
@@ -2586,7 +2644,385 @@ __checkpoint_tree_helper(WT_SESSION_IMPL *session, const char *cfg[])
      * the eviction server next wakes.
      */
     __wt_evict_server_wake(session);
+}
+
+/*
+ * __checkpoint_tree_ts_ignore --
+ *     Logged tables ignore any read timestamp configured for the checkpoint. Clear the use of the
+ *     timestamp for a logged tree, returning if it has to be restored for other tables.
+ */
+static bool
+__checkpoint_tree_ts_ignore(WT_SESSION_IMPL *session)
+{
+    WT_TXN *txn;
+
+    txn = session->txn;
+
+    if (!F_ISSET(S2BT(session), WT_BTREE_LOGGED) || !F_ISSET(txn, WT_TXN_SHARED_TS_READ))
+        return (false);
+    F_CLR(txn, WT_TXN_SHARED_TS_READ);
+    return (true);
+}
+
+/*
+ * __checkpoint_tree_helper --
+ *     Checkpoint a tree (suitable for use in *_apply functions).
+ */
+static int
+__checkpoint_tree_helper(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_DECL_RET;
+    bool ts_ignored;
+
+    __checkpoint_tree_handle_stress(session);
+
+    ts_ignored = __checkpoint_tree_ts_ignore(session);
+
+    ret = __checkpoint_tree(session, true, cfg);
+
+    /* Restore the use of the timestamp for other tables. */
+    if (ts_ignored)
+        F_SET(session->txn, WT_TXN_SHARED_TS_READ);
+
+    __checkpoint_tree_done(session);
+
+    return (ret);
+}
+
+/*
+ * __checkpoint_parallel_start --
+ *     Start the checkpoint of a tree the checkpoint threads will write.
+ */
+static int
+__checkpoint_parallel_start(WT_SESSION_IMPL *session, WT_CHECKPOINT_WORK_UNIT *unit)
+{
+    WT_DECL_RET;
+    bool ts_ignored;
+
+    __checkpoint_tree_handle_stress(session);
+
+    ts_ignored = __checkpoint_tree_ts_ignore(session);
+    ret = __checkpoint_tree_start(session, true, unit);
+    if (ts_ignored)
+        F_SET(session->txn, WT_TXN_SHARED_TS_READ);
+
+    return (ret);
+}
+
+/*
+ * __checkpoint_parallel_finish --
+ *     Finish the checkpoint of a tree the checkpoint threads have written, and release the tree.
+ */
+static int
+__checkpoint_parallel_finish(WT_SESSION_IMPL *session, WT_CHECKPOINT_WORK_UNIT *unit, int error)
+{
+    WT_DECL_RET;
+    bool ts_ignored;
+
+    ts_ignored = __checkpoint_tree_ts_ignore(session);
+    ret = __checkpoint_tree_finish(session, true, unit, error);
+    if (ts_ignored)
+        F_SET(session->txn, WT_TXN_SHARED_TS_READ);
+
+    __checkpoint_tree_done(session);
+
+    return (ret);
+}
+
+/*
+ * __checkpoint_work_claim --
+ *     Claim the next tree waiting to be written, if any.
+ */
+static WT_CHECKPOINT_WORK_UNIT *
+__checkpoint_work_claim(WT_SESSION_IMPL *session, WT_CHECKPOINT_WORK *work)
+{
+    WT_CHECKPOINT_WORK_UNIT *unit;
+
+    unit = NULL;
+    __wt_spin_lock(session, &work->lock);
+    if (work->next < work->entries)
+        unit = &work->units[work->next++];
+    __wt_spin_unlock(session, &work->lock);
+    return (unit);
+}
+
+/*
+ * __checkpoint_work_pending --
+ *     Return if there are trees waiting to be written.
+ */
+static bool
+__checkpoint_work_pending(WT_SESSION_IMPL *session, WT_CHECKPOINT_WORK *work)
+{
+    bool pending;
+
+    __wt_spin_lock(session, &work->lock);
+    pending = work->next < work->entries;
+    __wt_spin_unlock(session, &work->lock);
+    return (pending);
+}
+
+/*
+ * __checkpoint_work_write_tree --
+ *     Write a tree for the checkpoint. Threads other than the checkpoint session run as part of the
+ *     checkpoint, under the checkpoint's snapshot and read timestamp: the checkpoint transaction
+ *     keeps those pinned until every tree has been written.
+ */
+static int
+__checkpoint_work_write_tree(WT_SESSION_IMPL *session)
+{
+    WT_CHECKPOINT_WORK *work;
+    WT_DECL_RET;
+    bool ts_ignored;
+
+    work = &S2C(session)->ckpt_work;
+
+    if (session == work->session) {
+        ts_ignored = __checkpoint_tree_ts_ignore(session);
+        ret = __checkpoint_tree_write(session, true);
+        if (ts_ignored)
+            F_SET(session->txn, WT_TXN_SHARED_TS_READ);
+        return (ret);
+    }
+
+    /* Logged tables ignore any read timestamp configured for the checkpoint. */
+    F_SET(session, WT_SESSION_CHECKPOINT_THREAD | WT_SESSION_IGNORE_CACHE_SIZE);
+    __wt_txn_snapshot_borrow(session, &work->session->txn->snapshot_data,
+      F_ISSET(S2BT(session), WT_BTREE_LOGGED) ? WT_TS_NONE : work->read_timestamp);
+
+    ret = __checkpoint_tree_write(session, true);
+
+    __wt_txn_snapshot_borrow_end(session);
+    F_CLR(session, WT_SESSION_CHECKPOINT_THREAD | WT_SESSION_IGNORE_CACHE_SIZE);
+
+    return (ret);
+}
+
+/*
+ * __checkpoint_work_write --
+ *     Write a claimed tree. Once any tree has failed, the rest are skipped: the checkpoint cleans
+ *     up after them without writing them.
+ */
+static void
+__checkpoint_work_write(WT_SESSION_IMPL *session, WT_CHECKPOINT_WORK_UNIT *unit)
+{
+    WT_CHECKPOINT_WORK *work;
+    WT_DECL_RET;
+
+    work = &S2C(session)->ckpt_work;
+
+    if (!unit->fake_ckpt && !__wt_atomic_loadbool(&work->failed)) {
+        WT_WITH_DHANDLE(session, unit->dhandle, ret = __checkpoint_work_write_tree(session));
+        if (ret != 0) {
+            unit->ret = ret;
+            __wt_atomic_storebool(&work->failed, true);
+        }
+    }
+
+    /* The checkpoint can discard the tree once it's written, don't touch it after this. */
+    WT_RELEASE_WRITE(unit->written, true);
+    __wt_cond_signal(session, work->done_cond);
+}
+
+/*
+ * __checkpoint_thread_chk --
+ *     Check to decide if a checkpoint thread should wait for trees to write.
+ */
+static bool
+__checkpoint_thread_chk(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    return (
+      !F_ISSET(conn, WT_CONN_CLOSING) && !__checkpoint_work_pending(session, &conn->ckpt_work));
+}
+
+/*
+ * __checkpoint_thread_run --
+ *     Entry function for a checkpoint thread. This is called repeatedly from the thread group code
+ *     so it does not need to loop itself.
+ */
+static int
+__checkpoint_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CHECKPOINT_WORK *work;
+    WT_CHECKPOINT_WORK_UNIT *unit;
+    bool wrote;
+
+    work = &S2C(session)->ckpt_work;
+    wrote = false;
+
+    while ((unit = __checkpoint_work_claim(session, work)) != NULL) {
+        __checkpoint_work_write(session, unit);
+        wrote = true;
+    }
+
+    /*
+     * Reconciliation and block manager structures are kept from one page and tree to the next,
+     * release them once the checkpoint has no more trees to write.
+     */
+    if (wrote)
+        WT_RET(__wt_session_release_resources(session));
+
+    /* Wait for the next checkpoint. */
+    if (F_ISSET(thread, WT_THREAD_RUN))
+        __wt_cond_wait(
+          session, work->threads.wait_cond, 100 * WT_THOUSAND, __checkpoint_thread_chk);
+    return (0);
+}
+
+/*
+ * __checkpoint_threads_config --
+ *     Start, resize or stop the threads writing the trees of database checkpoints to match the
+ *     configured number. The threads are kept from one checkpoint to the next.
+ */
+static int
+__checkpoint_threads_config(WT_SESSION_IMPL *session, uint32_t threads)
+{
+    WT_CHECKPOINT_WORK *work;
+    WT_DECL_RET;
+
+    work = &S2C(session)->ckpt_work;
+
+    if (threads == 0)
+        return (__wt_checkpoint_threads_destroy(session));
+
+    if (work->done_cond == NULL) {
+        WT_RET(__wt_cond_alloc(session, "checkpoint trees", &work->done_cond));
+        if ((ret = __wt_spin_init(session, &work->lock, "checkpoint trees")) != 0) {
+            __wt_cond_destroy(session, &work->done_cond);
+            return (ret);
+        }
+    }
+
+    if (work->threads.max == threads)
+        return (0);
+    if (work->threads.max != 0)
+        return (__wt_thread_group_resize(
+          session, &work->threads, threads, threads, WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL));
+    return (__wt_thread_group_create(session, &work->threads, "checkpoint-threads", threads,
+      threads, WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL, __checkpoint_thread_chk,
+      __checkpoint_thread_run, NULL));
+}
+
+/*
+ * __wt_checkpoint_threads_destroy --
+ *     Stop the threads writing the trees of database checkpoints.
+ */
+int
+__wt_checkpoint_threads_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CHECKPOINT_WORK *work;
+    WT_DECL_RET;
+
+    work = &S2C(session)->ckpt_work;
+
+    if (work->threads.max != 0) {
+        /* The destroy function assumes it is called locked. */
+        __wt_writelock(session, &work->threads.lock);
+        WT_TRET(__wt_thread_group_destroy(session, &work->threads));
+    }
+    if (work->done_cond != NULL) {
+        __wt_cond_destroy(session, &work->done_cond);
+        __wt_spin_destroy(session, &work->lock);
+    }
+
+    return (ret);
+}
+
+/*
+ * __checkpoint_apply_trees_parallel --
+ *     Checkpoint the trees locked for a database checkpoint, writing them with the checkpoint
+ *     threads. Starting each tree and updating its metadata stays in the checkpoint session, in
+ *     handle order; only writing the trees is shared out.
+ */
+static int
+__checkpoint_apply_trees_parallel(WT_SESSION_IMPL *session)
+{
+    WT_CHECKPOINT_WORK *work;
+    WT_CHECKPOINT_WORK_UNIT *claimed, *unit, *units;
+    WT_DECL_RET;
+    uint32_t entries, i;
+    u_int h;
+    bool written;
+
+    work = &S2C(session)->ckpt_work;
+    entries = 0;
+
+    if (session->ckpt_handle_next == 0)
+        return (0);
+
+    WT_RET(__wt_calloc_def(session, session->ckpt_handle_next, &units));
+
+    /*
+     * Start every tree before any is written. If a tree fails to start, the trees already started
+     * still have to be finished, so they are cleaned up below.
+     */
+    for (h = 0; h < session->ckpt_handle_next; ++h) {
+        if (session->ckpt_handle[h] == NULL)
+            continue;
+        unit = &units[entries++];
+        WT_WITH_DHANDLE(
+          session, session->ckpt_handle[h], ret = __checkpoint_parallel_start(session, unit));
+        if (ret != 0) {
+            unit->ret = ret;
+            break;
+        }
+    }
+
+    /*
+     * Hand the trees to the threads. The threads run under the checkpoint transaction's snapshot
+     * and read timestamp, which don't change until the checkpoint resolves.
+     */
+    WT_ASSERT(session,
+      F_ISSET(session->txn, WT_TXN_HAS_SNAPSHOT) && F_ISSET(session->txn, WT_TXN_RUNNING));
+    work->session = session;
+    work->read_timestamp = F_ISSET(session->txn, WT_TXN_SHARED_TS_READ) ?
+      WT_SESSION_TXN_SHARED(session)->read_timestamp :
+      WT_TS_NONE;
+    __wt_atomic_storebool(&work->failed, ret != 0);
+    __wt_spin_lock(session, &work->lock);
+    work->units = units;
+    work->entries = entries;
+    work->next = 0;
+    __wt_spin_unlock(session, &work->lock);
+    __wt_cond_signal(session, work->threads.wait_cond);
+
+    /*
+     * Finish the trees in order as they are written. The checkpoint session writes trees too while
+     * it waits, so the checkpoint can't stall behind the threads.
+     */
+    for (i = 0; i < entries; ++i) {
+        unit = &units[i];
+        for (;;) {
+            WT_ACQUIRE_READ(written, unit->written);
+            if (written)
+                break;
+            if ((claimed = __checkpoint_work_claim(session, work)) != NULL)
+                __checkpoint_work_write(session, claimed);
+            else
+                __wt_cond_wait(session, work->done_cond, 10 * WT_THOUSAND, NULL);
+        }
+
+        /* Once any tree has failed, the remaining trees are only cleaned up. */
+        if (ret == 0)
+            ret = unit->ret;
+        WT_WITH_DHANDLE(
+          session, unit->dhandle, WT_TRET(__checkpoint_parallel_finish(session, unit, ret)));
+        if (ret != 0)
+            __wt_atomic_storebool(&work->failed, true);
+    }
+
+    /* Every tree has been claimed and written, the threads are done with them. */
+    __wt_spin_lock(session, &work->lock);
+    work->units = NULL;
+    work->entries = work->next = 0;
+    __wt_spin_unlock(session, &work->lock);
+    work->session = NULL;
+    work->read_timestamp = WT_TS_NONE;
 
+    __wt_free(session, units);
     return (ret);
 }
 
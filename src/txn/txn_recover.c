@@ -20,6 +20,18 @@ typedef struct {
     WT_LSN ckpt_lsn; /* File's checkpoint LSN. */
 } WT_RECOVERY_FILE;
 
+/*
+ * An operation copied for a recovery worker: its offsets in the batch it was copied into, and the
+ * LSN of its log record.
+ */
+typedef struct {
+    size_t offset; /* Start of the operation */
+    size_t end;    /* End of the operation */
+    WT_LSN lsn;    /* Operation's log record LSN */
+} WT_RECOVERY_OP;
+
+typedef struct __wt_recovery_worker WT_RECOVERY_WORKER;
+
 typedef struct {
     WT_SESSION_IMPL *session;
 
@@ -39,27 +51,52 @@ typedef struct {
                          * Set during the first recovery pass,
                          * when only the metadata is recovered.
                          */
+
+    /*
+     * Workers applying the main recovery pass. Operations are copied into one batch while the
+     * workers apply the other.
+     */
+    WT_RECOVERY_WORKER *workers;      /* Apply workers */
+    u_int nworkers;                   /* Number of apply workers */
+    WT_ITEM batch[2];                 /* Operations copied for the workers */
+    u_int batch_fill;                 /* Batch being filled */
+    u_int batch_run;                  /* Batch being applied */
+    wt_shared uint64_t batch_gen;     /* Incremented as each batch is handed over */
+    wt_shared uint32_t batch_pending; /* Workers still applying the batch */
+    WT_CONDVAR *batch_cond;           /* Workers wait for a batch */
+    WT_CONDVAR *done_cond;            /* Recovery waits for the workers */
+    wt_shared bool workers_stop;      /* Workers should exit */
 } WT_RECOVERY;
 
+/* A recovery worker, applying the operations for a subset of the files. */
+struct __wt_recovery_worker {
+    WT_RECOVERY r;          /* Worker's own session and cursors */
+    WT_RECOVERY *main;      /* Recovery handing over the operations */
+    wt_thread_t tid;        /* Worker thread */
+    bool tid_set;           /* Worker thread set */
+    int ret;                /* First error applying an operation */
+    WT_RECOVERY_OP *ops[2]; /* Operations in each batch */
+    size_t ops_alloc[2];    /* Allocated size of operation arrays */
+    u_int ops_next[2];      /* Number of operations in each batch */
+};
+
+/* Batch size at which operations are handed to the recovery workers. */
+#define WT_RECOVERY_BATCH_MAX (4 * WT_MEGABYTE)
+
 /*
- * __recovery_cursor --
- *     Get a cursor for a recovery operation.
+ * __recovery_file_applies --
+ *     Return if an operation on a file is to be applied during recovery.
  */
-static int
-__recovery_cursor(
-  WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_LSN *lsnp, u_int id, bool duplicate, WT_CURSOR **cp)
+static bool
+__recovery_file_applies(WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_LSN *lsnp, u_int id)
 {
-    WT_CURSOR *c;
-    const char *cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_open_cursor), "overwrite", NULL};
     bool metadata_op;
 
-    c = NULL;
-
     /*
      * File ids with the bit set to ignore this operation are skipped.
      */
     if (WT_LOGOP_IS_IGNORED(id))
-        return (0);
+        return (false);
     /*
      * Metadata operations have an id of 0. Match operations based on the id and the current pass of
      * recovery for metadata.
@@ -70,29 +107,48 @@ __recovery_cursor(
      */
     metadata_op = id == WT_METAFILE_ID;
     if (r->metadata_only != metadata_op)
-        ;
-    else if (id >= r->nfiles || r->files[id].uri == NULL) {
+        return (false);
+    if (id >= r->nfiles || r->files[id].uri == NULL) {
         /* If a file is missing, output a verbose message once. */
         if (!r->missing)
             __wt_verbose(
               session, WT_VERB_RECOVERY, "No file found with ID %u (max %u)", id, r->nfiles);
         r->missing = true;
-    } else if (__wt_log_cmp(lsnp, &r->files[id].ckpt_lsn) >= 0) {
-        /*
-         * We're going to apply the operation. Get the cursor, opening one if none is cached.
-         */
-        if ((c = r->files[id].c) == NULL) {
-            WT_RET(__wt_open_cursor(session, r->files[id].uri, NULL, cfg, &c));
-            r->files[id].c = c;
-        }
+        return (false);
+    }
+    if (__wt_log_cmp(lsnp, &r->files[id].ckpt_lsn) < 0)
+        return (false);
 #ifndef WT_STANDALONE_BUILD
-        /*
-         * In the event of a clean shutdown, there shouldn't be any other table log records other
-         * than metadata.
-         */
-        if (!metadata_op)
-            S2C(session)->unclean_shutdown = true;
+    /*
+     * In the event of a clean shutdown, there shouldn't be any other table log records other than
+     * metadata. Recovery workers only see operations already checked here, don't write the flag
+     * from more than one thread.
+     */
+    if (!metadata_op && !S2C(session)->unclean_shutdown)
+        S2C(session)->unclean_shutdown = true;
 #endif
+    return (true);
+}
+
+/*
+ * __recovery_cursor --
+ *     Get a cursor for a recovery operation.
+ */
+static int
+__recovery_cursor(
+  WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_LSN *lsnp, u_int id, bool duplicate, WT_CURSOR **cp)
+{
+    WT_CURSOR *c;
+    const char *cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_open_cursor), "overwrite", NULL};
+
+    c = NULL;
+
+    /*
+     * We're going to apply the operation. Get the cursor, opening one if none is cached.
+     */
+    if (__recovery_file_applies(session, r, lsnp, id) && (c = r->files[id].c) == NULL) {
+        WT_RET(__wt_open_cursor(session, r->files[id].uri, NULL, cfg, &c));
+        r->files[id].c = c;
     }
 
     if (duplicate && c != NULL)
@@ -474,6 +530,280 @@ err:
     return (ret);
 }
 
+/*
+ * __recovery_op_fileid --
+ *     Return the file ID of an operation the recovery workers can apply, WT_NOTFOUND for any other
+ *     operation.
+ */
+static int
+__recovery_op_fileid(WT_SESSION_IMPL *session, const uint8_t *p, const uint8_t *end,
+  uint32_t optype, uint32_t *fileidp)
+{
+    WT_ITEM key, value;
+    uint64_t recno;
+
+    switch (optype) {
+    case WT_LOGOP_COL_MODIFY:
+        return (__wt_logop_col_modify_unpack(session, &p, end, fileidp, &recno, &value));
+    case WT_LOGOP_COL_PUT:
+        return (__wt_logop_col_put_unpack(session, &p, end, fileidp, &recno, &value));
+    case WT_LOGOP_COL_REMOVE:
+        return (__wt_logop_col_remove_unpack(session, &p, end, fileidp, &recno));
+    case WT_LOGOP_ROW_MODIFY:
+        return (__wt_logop_row_modify_unpack(session, &p, end, fileidp, &key, &value));
+    case WT_LOGOP_ROW_PUT:
+        return (__wt_logop_row_put_unpack(session, &p, end, fileidp, &key, &value));
+    case WT_LOGOP_ROW_REMOVE:
+        return (__wt_logop_row_remove_unpack(session, &p, end, fileidp, &key));
+    }
+    return (WT_NOTFOUND);
+}
+
+/*
+ * __recovery_worker --
+ *     Recovery worker thread: apply this worker's operations from each batch handed over.
+ */
+static WT_THREAD_RET
+__recovery_worker(void *arg)
+{
+    WT_RECOVERY *r;
+    WT_RECOVERY_OP *op;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    uint64_t gen, seen;
+    u_int i, run;
+    const uint8_t *base, *p;
+
+    worker = arg;
+    r = worker->main;
+    session = worker->r.session;
+
+    for (seen = 0;;) {
+        WT_ACQUIRE_READ(gen, r->batch_gen);
+        if (gen == seen) {
+            if (__wt_atomic_loadbool(&r->workers_stop))
+                break;
+            __wt_cond_wait(session, r->batch_cond, 10 * WT_THOUSAND, NULL);
+            continue;
+        }
+        seen = gen;
+
+        /* Once an operation fails, skip the rest: recovery stops at the next batch. */
+        run = r->batch_run;
+        base = r->batch[run].mem;
+        for (i = 0; worker->ret == 0 && i < worker->ops_next[run]; ++i) {
+            op = &worker->ops[run][i];
+            p = base + op->offset;
+            worker->ret = __txn_op_apply(&worker->r, &op->lsn, &p, base + op->end);
+        }
+
+        if (__wt_atomic_sub32(&r->batch_pending, 1) == 0)
+            __wt_cond_signal(session, r->done_cond);
+    }
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __recovery_batch_wait --
+ *     Wait for the workers to finish applying the batch handed over last.
+ */
+static int
+__recovery_batch_wait(WT_RECOVERY *r)
+{
+    uint32_t pending;
+    u_int i;
+
+    for (;;) {
+        WT_ACQUIRE_READ(pending, r->batch_pending);
+        if (pending == 0)
+            break;
+        __wt_cond_wait(r->session, r->done_cond, 10 * WT_THOUSAND, NULL);
+    }
+
+    for (i = 0; i < r->nworkers; ++i)
+        WT_RET(r->workers[i].ret);
+    return (0);
+}
+
+/*
+ * __recovery_batch_dispatch --
+ *     Hand the batch being filled over to the workers, optionally waiting for them to apply it.
+ */
+static int
+__recovery_batch_dispatch(WT_RECOVERY *r, bool wait)
+{
+    u_int fill, i;
+
+    /* Once the workers are done with the other batch, fill it while they apply this one. */
+    WT_RET(__recovery_batch_wait(r));
+
+    fill = r->batch_fill;
+    if (r->batch[fill].size != 0) {
+        r->batch_run = fill;
+        __wt_atomic_store32(&r->batch_pending, r->nworkers);
+        (void)__wt_atomic_add64(&r->batch_gen, 1);
+        __wt_cond_signal(r->session, r->batch_cond);
+
+        r->batch_fill = fill = fill ^ 1;
+        r->batch[fill].size = 0;
+        for (i = 0; i < r->nworkers; ++i)
+            r->workers[i].ops_next[fill] = 0;
+    }
+
+    return (wait ? __recovery_batch_wait(r) : 0);
+}
+
+/*
+ * __recovery_commit_dispatch --
+ *     Copy the operations in a commit record for the recovery workers.
+ */
+static int
+__recovery_commit_dispatch(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
+{
+    WT_DECL_RET;
+    WT_ITEM *batch;
+    WT_RECOVERY_OP *op;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    size_t offset;
+    uint32_t fileid, opsize, optype;
+    u_int fill;
+
+    session = r->session;
+
+    /* The logging subsystem zero-pads records. */
+    while (*pp < end && **pp) {
+        WT_RET(__wt_logop_read(session, pp, end, &optype, &opsize));
+        if (WT_LOGOP_IS_IGNORED(optype) && opsize <= WT_PTRDIFF(end, *pp)) {
+            *pp += opsize;
+            continue;
+        }
+
+        /*
+         * Truncate operations can cover more than a key: apply them, and anything else the workers
+         * don't handle, once the workers have applied everything before them.
+         */
+        if (opsize > WT_PTRDIFF(end, *pp) ||
+          (ret = __recovery_op_fileid(session, *pp, *pp + opsize, optype, &fileid)) ==
+            WT_NOTFOUND) {
+            WT_RET(__recovery_batch_dispatch(r, true));
+            WT_RET(__txn_op_apply(r, lsnp, pp, end));
+            continue;
+        }
+        WT_RET(ret);
+
+        if (!__recovery_file_applies(session, r, lsnp, fileid)) {
+            *pp += opsize;
+            continue;
+        }
+
+        /*
+         * Copy the operation, the log scan reuses its buffer for the next record. A file's
+         * operations always go to the same worker, so they are applied in log order.
+         */
+        fill = r->batch_fill;
+        batch = &r->batch[fill];
+        offset = batch->size;
+        WT_RET(__wt_buf_grow(session, batch, offset + opsize));
+        memcpy((uint8_t *)batch->mem + offset, *pp, opsize);
+        batch->size = offset + opsize;
+        *pp += opsize;
+
+        worker = &r->workers[fileid % r->nworkers];
+        WT_RET(__wt_realloc_def(
+          session, &worker->ops_alloc[fill], worker->ops_next[fill] + 1, &worker->ops[fill]));
+        op = &worker->ops[fill][worker->ops_next[fill]++];
+        op->offset = offset;
+        op->end = batch->size;
+        WT_ASSIGN_LSN(&op->lsn, lsnp);
+    }
+
+    if (r->batch[r->batch_fill].size >= WT_RECOVERY_BATCH_MAX)
+        WT_RET(__recovery_batch_dispatch(r, false));
+    return (0);
+}
+
+/*
+ * __recovery_workers_start --
+ *     Start the workers applying the main recovery pass.
+ */
+static int
+__recovery_workers_start(WT_RECOVERY *r, u_int nworkers)
+{
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    u_int i, j;
+
+    session = r->session;
+
+    WT_RET(__wt_cond_alloc(session, "recovery batch", &r->batch_cond));
+    WT_RET(__wt_cond_alloc(session, "recovery batch done", &r->done_cond));
+    WT_RET(__wt_calloc_def(session, nworkers, &r->workers));
+    r->nworkers = nworkers;
+
+    for (i = 0; i < nworkers; ++i) {
+        worker = &r->workers[i];
+        worker->main = r;
+        WT_RET(__wt_open_internal_session(
+          S2C(session), "txn-recover-worker", false, 0, 0, &worker->r.session));
+
+        /* Workers share the file names, but open their own cursors. */
+        WT_RET(__wt_calloc_def(session, r->nfiles, &worker->r.files));
+        worker->r.nfiles = r->nfiles;
+        for (j = 0; j < r->nfiles; ++j) {
+            worker->r.files[j].uri = r->files[j].uri;
+            WT_ASSIGN_LSN(&worker->r.files[j].ckpt_lsn, &r->files[j].ckpt_lsn);
+        }
+
+        WT_RET(__wt_thread_create(session, &worker->tid, __recovery_worker, worker));
+        worker->tid_set = true;
+    }
+    return (0);
+}
+
+/*
+ * __recovery_workers_stop --
+ *     Stop the recovery workers and discard their resources.
+ */
+static int
+__recovery_workers_stop(WT_RECOVERY *r)
+{
+    WT_CURSOR *c;
+    WT_DECL_RET;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    u_int i, j;
+
+    session = r->session;
+
+    __wt_atomic_storebool(&r->workers_stop, true);
+    if (r->batch_cond != NULL)
+        __wt_cond_signal(session, r->batch_cond);
+
+    for (i = 0; i < r->nworkers; ++i) {
+        worker = &r->workers[i];
+        if (worker->tid_set)
+            WT_TRET(__wt_thread_join(session, &worker->tid));
+        if (worker->r.files != NULL)
+            for (j = 0; j < worker->r.nfiles; ++j)
+                if ((c = worker->r.files[j].c) != NULL)
+                    WT_TRET(c->close(c));
+        __wt_free(session, worker->r.files);
+        __wt_free(session, worker->ops[0]);
+        __wt_free(session, worker->ops[1]);
+        if (worker->r.session != NULL)
+            WT_TRET(__wt_session_close_internal(worker->r.session));
+    }
+    __wt_free(session, r->workers);
+    r->nworkers = 0;
+
+    __wt_cond_destroy(session, &r->batch_cond);
+    __wt_cond_destroy(session, &r->done_cond);
+    __wt_buf_free(session, &r->batch[0]);
+    __wt_buf_free(session, &r->batch[1]);
+    return (ret);
+}
+
 /*
  * __txn_commit_apply --
  *     Apply a commit record during recovery.
@@ -481,6 +811,9 @@ err:
 static int
 __txn_commit_apply(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
 {
+    if (r->workers != NULL)
+        return (__recovery_commit_dispatch(r, lsnp, pp, end));
+
     /* The logging subsystem zero-pads records. */
     while (*pp < end && **pp)
         WT_RET(__txn_op_apply(r, lsnp, pp, end));
@@ -937,6 +1270,7 @@ err:
 int
 __wt_txn_recover(WT_SESSION_IMPL *session, const char *cfg[])
 {
+    WT_CONFIG_ITEM cval;
     WT_CONNECTION_IMPL *conn;
     WT_CURSOR *metac;
     WT_DECL_ITEM(ckpt_lsn_str);
@@ -1143,11 +1477,26 @@ __wt_txn_recover(WT_SESSION_IMPL *session, const char *cfg[])
      */
     if (needs_rec)
         F_SET(&conn->log_mgr, WT_LOG_RECOVER_DIRTY);
+
+    /*
+     * Optionally apply the log with worker threads, this thread decodes the log and hands each
+     * operation to the worker for its file.
+     */
+    WT_ERR(__wt_config_gets(session, cfg, "log.recover_threads", &cval));
+    if (cval.val != 0) {
+        __wt_verbose_level_multi(session, WT_VERB_RECOVERY_ALL, WT_VERBOSE_INFO,
+          "Main recovery loop: applying log records with %" PRId64 " threads", cval.val);
+        WT_ERR(__recovery_workers_start(&r, (u_int)cval.val));
+    }
     if (WT_IS_INIT_LSN(&r.ckpt_lsn))
         ret = __wt_log_scan(
           session, NULL, NULL, WT_LOGSCAN_FIRST | WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
     else
         ret = __wt_log_scan(session, &r.ckpt_lsn, NULL, WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
+    if (r.workers != NULL) {
+        WT_TRET(__recovery_batch_dispatch(&r, true));
+        WT_TRET(__recovery_workers_stop(&r));
+    }
     if (F_ISSET(conn, WT_CONN_SALVAGE))
         ret = 0;
     WT_ERR(ret);
@@ -1273,6 +1622,7 @@ err:
     __wt_scr_free(session, &ckpt_lsn_str);
     __wt_scr_free(session, &max_rec_lsn_str);
 
+    WT_TRET(__recovery_workers_stop(&r));
     WT_TRET(__recovery_close_cursors(&r));
     __wt_free(session, config);
     F_CLR(&conn->log_mgr, WT_LOG_RECOVER_DIRTY);
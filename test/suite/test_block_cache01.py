@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import random, threading
+import wttest
+from wiredtiger import stat
+
+# test_block_cache01.py
+#    Test block cache lookups racing with block cache eviction and block removal: readers look up
+#    blocks without locking while the eviction clock and checkpoints unlink and free them.
+class test_block_cache01(wttest.WiredTigerTestCase):
+    uri = 'table:test_block_cache01'
+    nrows = 20000
+    nreaders = 4
+    nreads = 20000
+    nupdates = 4
+
+    # A small connection cache so pages are regularly read back through the block cache, and a
+    # block cache much smaller than the table with a low eviction target so the clock runs
+    # continuously.
+    conn_config = 'cache_size=1MB,statistics=(all),' + \
+        'block_cache=(enabled=true,type=DRAM,size=1MB,hashsize=512,full_target=30)'
+
+    def value(self, k, gen):
+        return '%d-%d-' % (k, gen) + 'a' * 100
+
+    def reader(self, seed, failures):
+        session = self.conn.open_session()
+        cursor = session.open_cursor(self.uri)
+        r = random.Random(seed)
+        try:
+            for _ in range(self.nreads):
+                k = r.randint(1, self.nrows)
+                cursor.set_key(k)
+                if cursor.search() != 0:
+                    failures.append('key %d not found' % k)
+                    return
+                v = cursor.get_value()
+                if not v.startswith('%d-' % k) or not v.endswith('a' * 100):
+                    failures.append('key %d has value %s' % (k, v))
+                    return
+                cursor.reset()
+        except Exception as e:
+            failures.append(str(e))
+        finally:
+            session.close()
+
+    def test_block_cache_race(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S,leaf_page_max=4KB')
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(1, self.nrows + 1):
+            cursor[k] = self.value(k, 0)
+        cursor.close()
+        self.session.checkpoint()
+
+        # Readers race with eviction, while the main thread rewrites the table and checkpoints,
+        # freeing blocks other threads may be looking up.
+        failures = []
+        readers = [threading.Thread(target=self.reader, args=(i, failures))
+            for i in range(self.nreaders)]
+        for t in readers:
+            t.start()
+        cursor = self.session.open_cursor(self.uri)
+        for gen in range(1, self.nupdates + 1):
+            for k in range(1, self.nrows + 1, 7):
+                cursor[k] = self.value(k, gen)
+            self.session.checkpoint()
+        cursor.close()
+        for t in readers:
+            t.join()
+        self.assertEqual(failures, [])
+
+        stat_cursor = self.session.open_cursor('statistics:')
+        hits = stat_cursor[stat.conn.block_cache_hits][2]
+        evicted = stat_cursor[stat.conn.block_cache_blocks_evicted][2]
+        removed = stat_cursor[stat.conn.block_cache_blocks_removed][2]
+        stat_cursor.close()
+        self.assertGreater(hits, 0)
+        self.assertGreater(evicted, 0)
+        self.assertGreater(removed, 0)
+
+        # Every key has its last value.
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(1, self.nrows + 1):
+            self.assertEqual(cursor[k], self.value(k, self.nupdates if (k - 1) % 7 == 0 else 0))
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
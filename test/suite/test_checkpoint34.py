@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wttest
+from wtscenario import make_scenarios
+
+# test_checkpoint34.py
+#    Test checkpoints writing trees with a group of threads: every tree has to hold exactly the
+#    data that was stable when the checkpoint started.
+class test_checkpoint34(wttest.WiredTigerTestCase):
+    ntables = 20
+    nrows = 2000
+    uri = 'table:test_checkpoint34_'
+
+    threads_values = [
+        ('serial', dict(threads=0)),
+        ('threads-1', dict(threads=1)),
+        ('threads-4', dict(threads=4)),
+    ]
+    scenarios = make_scenarios(threads_values)
+
+    def conn_config(self):
+        return 'cache_size=50MB,checkpoint=(threads={})'.format(self.threads)
+
+    def populate(self, value, ts):
+        for t in range(self.ntables):
+            c = self.session.open_cursor(self.uri + str(t))
+            self.session.begin_transaction()
+            for i in range(1, self.nrows):
+                c[i] = value + str(t)
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+            c.close()
+
+    def check(self, value, ckpt_name=None):
+        for t in range(self.ntables):
+            config = None if ckpt_name is None else 'checkpoint=' + ckpt_name
+            c = self.session.open_cursor(self.uri + str(t), None, config)
+            count = 0
+            for k, v in c:
+                self.assertEqual(v, value + str(t))
+                count += 1
+            self.assertEqual(count, self.nrows - 1)
+            c.close()
+
+    def test_checkpoint34(self):
+        for t in range(self.ntables):
+            self.session.create(self.uri + str(t), 'key_format=i,value_format=S')
+
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1))
+        self.populate('a' * 100, 10)
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(10))
+        self.populate('b' * 100, 20)
+
+        # A named checkpoint and the database checkpoint both stop at the stable timestamp.
+        self.session.checkpoint('name=ckpt34')
+        self.check('a' * 100, 'ckpt34')
+        self.session.checkpoint()
+
+        # The threads are kept between checkpoints: grow, stop and restart them.
+        for threads in [self.threads + 2, 0, self.threads]:
+            self.conn.reconfigure('checkpoint=(threads={})'.format(threads))
+            self.session.checkpoint()
+
+        self.reopen_conn()
+        self.check('a' * 100)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+from eviction_util import eviction_util
+from wtscenario import make_scenarios
+from wiredtiger import stat
+
+# test_eviction04.py
+# Fill a small cache from several tables with eviction workers walking trees in parallel with the
+# eviction server, and check the data survives the eviction and dropping tables while eviction runs.
+class test_eviction04(eviction_util):
+    ntables = 8
+    nrows = 5000
+    value = 'v' * 500
+
+    parallel_walk_values = [
+        ('parallel', dict(parallel_walk=True)),
+        ('serial', dict(parallel_walk=False)),
+    ]
+    scenarios = make_scenarios(parallel_walk_values)
+
+    def conn_config(self):
+        return 'cache_size=10MB,statistics=(all),eviction=(threads_min=4,threads_max=4,' + \
+            'parallel_walk={})'.format('true' if self.parallel_walk else 'false')
+
+    def test_eviction04(self):
+        uris = ['table:eviction04_{}'.format(i) for i in range(self.ntables)]
+        for uri in uris:
+            self.session.create(uri, 'key_format=i,value_format=S')
+            c = self.session.open_cursor(uri)
+            for k in range(self.nrows):
+                c[k] = self.value + str(k)
+            c.close()
+
+        # Read the tables back, the cache only holds a fraction of them.
+        for uri in uris:
+            c = self.session.open_cursor(uri)
+            count = 0
+            for k, v in c:
+                self.assertEqual(v, self.value + str(k))
+                count += 1
+            c.close()
+            self.assertEqual(count, self.nrows)
+
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_clean) +
+            self.get_stat(stat.conn.cache_eviction_dirty), 0)
+        if not self.parallel_walk:
+            self.assertEqual(self.get_stat(stat.conn.eviction_worker_walk), 0)
+            self.assertEqual(self.get_stat(stat.conn.eviction_worker_walk_pages_merged), 0)
+
+        # Dropping a table needs exclusive access, which waits for any worker walking it.
+        for uri in uris[::2]:
+            self.dropUntilSuccess(self.session, uri)
+
+        # Switch the setting at runtime and check the remaining tables.
+        self.conn.reconfigure('eviction=(parallel_walk={})'.format(
+            'false' if self.parallel_walk else 'true'))
+        for uri in uris[1::2]:
+            c = self.session.open_cursor(uri)
+            for k in range(0, self.nrows, 97):
+                self.assertEqual(c[k], self.value + str(k))
+            c.close()
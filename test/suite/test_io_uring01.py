@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os
+import helper, wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_io_uring01.py
+#    Test the io_uring configuration, and that pre-fetch returns the correct data when it reads
+#    pages with io_uring.
+
+class test_io_uring01(wttest.WiredTigerTestCase):
+    new_dir = 'new.dir'
+    nrows = 50000
+    uri = 'file:test_io_uring01'
+
+    depth_values = [
+        ('depth-1', dict(queue_depth=1)),
+        ('depth-64', dict(queue_depth=64)),
+    ]
+
+    scenarios = make_scenarios(depth_values)
+
+    def open_io_uring(self, cfg):
+        try:
+            return self.wiredtiger_open(self.new_dir, cfg)
+        except wiredtiger.WiredTigerError as e:
+            if 'io_uring' in str(e) or 'Operation not supported' in str(e):
+                self.skipTest('io_uring is not supported: ' + str(e))
+            raise
+
+    def test_io_uring_in_memory(self):
+        os.mkdir(self.new_dir)
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.wiredtiger_open(self.new_dir, 'in_memory=true,io_uring=(enabled=true)'),
+            '/only supported by the built-in POSIX file system/')
+
+    def test_io_uring_prefetch(self):
+        os.mkdir(self.new_dir)
+        helper.copy_wiredtiger_home(self, '.', self.new_dir)
+
+        conn_cfg = 'io_uring=(enabled=true,queue_depth=%d),' % self.queue_depth + \
+            'prefetch=(available=true,default=true),statistics=(all)'
+        new_conn = self.open_io_uring(conn_cfg)
+        s = new_conn.open_session()
+        s.create(self.uri, 'allocation_size=512,leaf_page_max=512,key_format=i,value_format=S')
+        c = s.open_cursor(self.uri)
+        s.begin_transaction()
+        for i in range(1, self.nrows):
+            c[i] = str(i) * 10
+        s.commit_transaction()
+        c.close()
+        s.checkpoint()
+        new_conn.close()
+
+        # Reopen with a cold cache and scan the table with pre-fetch enabled: the pre-fetch threads
+        # read the leaf pages with io_uring, check every page they brought into the cache.
+        new_conn = self.open_io_uring(conn_cfg)
+        s = new_conn.open_session('prefetch=(enabled=true)')
+        c = s.open_cursor(self.uri)
+        i = 1
+        while c.next() == 0:
+            self.assertEqual(c.get_key(), i)
+            self.assertEqual(c.get_value(), str(i) * 10)
+            i += 1
+        self.assertEqual(i, self.nrows)
+        c.close()
+
+        # Verify the table, verify pre-fetches pages as well.
+        s.verify(self.uri)
+
+        stat_cursor = s.open_cursor('statistics:')
+        submitted = stat_cursor[wiredtiger.stat.conn.block_read_io_uring_submitted][2]
+        sync = stat_cursor[wiredtiger.stat.conn.block_read_io_uring_sync][2]
+        hit = stat_cursor[wiredtiger.stat.conn.block_read_async_hit][2]
+        stat_cursor.close()
+
+        # Pages were read into the cache from completed asynchronous reads. A pre-fetch batch can
+        # hold more reads than a ring with a single entry, the reads that don't fit are done
+        # synchronously; a deeper ring submits the reads to the kernel.
+        self.assertGreater(hit, 0)
+        if self.queue_depth == 1:
+            self.assertGreater(sync, 0)
+        else:
+            self.assertGreater(submitted, 0)
+        new_conn.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_numa01.py
+#    Test the NUMA configuration: with a small cache, eviction bound to NUMA nodes has to keep up
+#    with the application and the data must be intact. The topology is either the system's, or a
+#    fake one so the per-node paths run on any machine.
+
+# A fake sysfs node directory, mapping node IDs to CPU lists. Nodes are numbered sparsely, node 1
+# has no CPUs and node 2 isn't there at all: there are two nodes with CPUs, and every CPU not
+# listed for node 0 is on node 3.
+fake_topology = {
+    'online': '0-3',
+    'node0/cpulist': '1,4-7',
+    'node1/cpulist': '',
+    'node3/cpulist': '0,2-3,8-1023',
+}
+
+class test_numa01(wttest.WiredTigerTestCase):
+    nrows = 100000
+    uri = 'table:test_numa01'
+
+    scenarios = make_scenarios([
+        ('system', dict(fake=False)),
+        ('fake', dict(fake=True)),
+    ])
+
+    def make_topology(self, topology, dirname='sysfs'):
+        sysfs = os.path.abspath(dirname)
+        for name, contents in topology.items():
+            path = os.path.join(sysfs, name)
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            with open(path, 'w') as f:
+                f.write(contents + '\n')
+        return sysfs
+
+    def conn_config(self):
+        config = 'cache_size=10MB,eviction=(threads_min=4,threads_max=4),statistics=(all),'
+        if self.fake:
+            return config + 'numa=(enabled=true,sysfs_path={})'.format(
+                self.make_topology(fake_topology))
+        return config + 'numa=(enabled=true)'
+
+    def setUpConnectionOpen(self, home):
+        try:
+            return wttest.WiredTigerTestCase.setUpConnectionOpen(self, home)
+        except wiredtiger.WiredTigerError as e:
+            if not self.fake and 'NUMA' in str(e):
+                self.skipTest('NUMA is not supported: ' + str(e))
+            raise
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        value = stat_cursor[stat][2]
+        stat_cursor.close()
+        return value
+
+    def test_numa(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows):
+            self.session.begin_transaction()
+            c[i] = str(i) * 20
+            self.session.commit_transaction()
+        c.close()
+        self.session.checkpoint()
+
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows):
+            self.assertEqual(c[i], str(i) * 20)
+        c.close()
+
+        # With the fake topology there are two nodes, the eviction threads are bound to them and
+        # the threads on the node holding the pages prefer those pages.
+        if self.fake:
+            self.assertGreater(self.get_stat(wiredtiger.stat.conn.eviction_worker_numa_local), 0)
+
+    def test_numa_topology_errors(self):
+        if not self.fake:
+            self.skipTest('the topology errors are only tested with a fake topology')
+        self.close_conn()
+
+        # No nodes with CPUs.
+        sysfs = self.make_topology(
+            {'online': '0-1', 'node0/cpulist': '', 'node1/cpulist': ''}, 'sysfs-no-cpus')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.wiredtiger_open('.', 'numa=(enabled=true,sysfs_path={})'.format(sysfs)),
+            '/unable to discover/')
+
+        # More nodes with CPUs than can be tracked.
+        topology = {'online': '0,2-9'}
+        for node in [0] + list(range(2, 10)):
+            topology['node{}/cpulist'.format(node)] = str(node)
+        sysfs = self.make_topology(topology, 'sysfs-too-many')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.wiredtiger_open('.', 'numa=(enabled=true,sysfs_path={})'.format(sysfs)),
+            '/more than 8 NUMA nodes/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+
+# test_prefetch04.py
+#    Pre-fetch reads physically adjacent blocks with a single read and splits them afterwards,
+#    check a cold scan returns the correct data.
+class test_prefetch04(wttest.WiredTigerTestCase):
+    conn_config = 'prefetch=(available=true,default=true),statistics=(all)'
+    nrows = 50000
+    uri = 'file:test_prefetch04'
+
+    def get_stat(self, stat_name):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat_name][2]
+        stat_cursor.close()
+        return val
+
+    def test_prefetch_coalesce(self):
+        self.session.create(self.uri,
+            'allocation_size=512,leaf_page_max=512,key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri)
+        self.session.begin_transaction()
+        for i in range(1, self.nrows):
+            c[i] = str(i) * 10
+        self.session.commit_transaction()
+        c.close()
+        self.session.checkpoint()
+
+        # The checkpoint writes the leaf pages in key order, mostly next to each other in the file.
+        self.reopen_conn()
+        self.session = self.conn.open_session('prefetch=(enabled=true)')
+        c = self.session.open_cursor(self.uri)
+        i = 1
+        while c.next() == 0:
+            self.assertEqual(c.get_key(), i)
+            self.assertEqual(c.get_value(), str(i) * 10)
+            i += 1
+        self.assertEqual(i, self.nrows)
+        c.close()
+
+        self.session.verify(self.uri)
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.block_read_async_coalesced), 0)
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.block_read_async_hit), 0)
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_search_batch01.py
+#   Test the cursor search_batch method.
+
+import wiredtiger, wttest
+from wtdataset import SimpleDataSet, ComplexDataSet
+from wtscenario import make_scenarios
+
+class test_search_batch01(wttest.WiredTigerTestCase):
+    nentries = 100
+
+    scenarios = make_scenarios([
+        ('file-r', dict(uri='file:', keyfmt='r', dataset=SimpleDataSet)),
+        ('file-S', dict(uri='file:', keyfmt='S', dataset=SimpleDataSet)),
+        ('table-r', dict(uri='table:', keyfmt='r', dataset=SimpleDataSet)),
+        ('table-S', dict(uri='table:', keyfmt='S', dataset=SimpleDataSet)),
+        ('table-S-complex', dict(uri='table:', keyfmt='S', dataset=ComplexDataSet)),
+    ])
+
+    def test_search_batch(self):
+        uri = self.uri + 'search_batch01'
+        ds = self.dataset(self, uri, self.nentries, key_format=self.keyfmt)
+        ds.populate()
+        cursor = ds.open_cursor(uri, None)
+
+        # Present keys, in no particular order, mixed with absent keys. The
+        # results come back in the order of the keys, with None for keys not
+        # found.
+        present = [ds.key(i) for i in (57, 1, self.nentries, 23, 23)]
+        keys = present[:2] + [ds.key(self.nentries + 10)] + present[2:]
+        expected = [ds.comparable_value(i) for i in (57, 1)] + [None] + \
+            [ds.comparable_value(i) for i in (self.nentries, 23, 23)]
+        values = cursor.search_batch(keys)
+        self.assertEqual(len(values), len(keys))
+        for value, expect in zip(values, expected):
+            if expect is None:
+                self.assertIsNone(value)
+            elif type(value) == tuple:
+                self.assertEqual(list(value), expect)
+            else:
+                self.assertEqual(value, expect)
+
+        # The cursor is left unpositioned.
+        self.assertRaisesException(wiredtiger.WiredTigerError, lambda: cursor.get_key())
+
+        # Every key absent.
+        keys = [ds.key(self.nentries + i) for i in range(1, 5)]
+        self.assertEqual(cursor.search_batch(keys), [None] * len(keys))
+
+        # An empty batch.
+        self.assertEqual(cursor.search_batch([]), [])
+
+        # The cursor remains usable after a batch.
+        cursor.set_key(ds.key(10))
+        self.assertEqual(cursor.search(), 0)
+        cursor.close()
+
+    def test_search_batch_errors(self):
+        uri = self.uri + 'search_batch01'
+        ds = self.dataset(self, uri, self.nentries, key_format=self.keyfmt)
+        ds.populate()
+
+        # Errors from the underlying cursor are raised.
+        cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertRaisesException(wiredtiger.WiredTigerError,
+            lambda: cursor.search_batch([1]), '/not supported/')
+        cursor.close()
+
+        # Keys that don't match the key format are rejected.
+        cursor = ds.open_cursor(uri, None)
+        badkey = 'abc' if self.keyfmt == 'r' else 10
+        self.assertRaises((TypeError, ValueError, wiredtiger.WiredTigerError),
+            lambda: cursor.search_batch([badkey]))
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
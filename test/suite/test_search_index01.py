@@ -0,0 +1,144 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_search_index01.py
+#   Test searches of row-store leaf pages with a key-prefix search index. The
+#   index is built the first time a page read from disk is searched, for pages
+#   with at least 32 entries, so every test reopens the connection before
+#   searching.
+
+import bisect
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# Key generators: each returns the sorted list of keys to load.
+def long_prefix(n):
+    # A common prefix longer than the 56 bytes the index can hold.
+    return [b'p' * 70 + b'%06d' % i for i in range(n)]
+
+def long_keys(n):
+    # Keys longer than 64 bytes, differing only after the bytes the index holds, so groups of keys
+    # share an index value.
+    return sorted([b'%03d' % (i // 10) + b'y' * 70 + b'%02d' % (i % 10) for i in range(n)])
+
+def zero_padding(n):
+    # Keys with trailing NUL bytes, which the index can't distinguish from its zero padding.
+    keys = []
+    for i in range(n // 3 + 1):
+        keys += [b'k%04d' % i, b'k%04d\x00' % i, b'k%04d\x00\x00' % i]
+    return sorted(keys[:n])
+
+def short_keys(n):
+    # Keys of different lengths, some of them prefixes of others.
+    return sorted(set([b'%d' % i for i in range(n)]))
+
+class test_search_index01(wttest.WiredTigerTestCase):
+    uri = 'file:test_search_index01'
+
+    key_types = [
+        ('long-prefix', dict(keygen=long_prefix)),
+        ('long-keys', dict(keygen=long_keys)),
+        ('zero-padding', dict(keygen=zero_padding)),
+        ('short-keys', dict(keygen=short_keys)),
+    ]
+    # Pages just below and at the index threshold, and trees with many pages.
+    nentries = [
+        ('31', dict(nentries=31)),
+        ('32', dict(nentries=32)),
+        ('5000', dict(nentries=5000)),
+    ]
+    scenarios = make_scenarios(key_types, nentries)
+
+    def value(self, key):
+        return b'value-' + key
+
+    # Keys that aren't in the tree: each key with bytes removed, added and changed, keys shorter
+    # than the common prefix, and keys sorting before and after every key. Empty keys aren't
+    # permitted.
+    def absent_keys(self, keys):
+        candidates = [b'\x00', b'\xff' * 80, keys[0][:1], keys[0][:10], keys[0][:60]]
+        for key in keys[::7]:
+            candidates += [key[:-1], key + b'\x00', key + b'\x01', key[:-1] + b'\xff']
+            if key[-1] != 0:
+                candidates.append(key[:-1] + bytes([key[-1] - 1]) + b'\xff')
+        keyset = set(keys)
+        return sorted(set([k for k in candidates if len(k) > 0 and k not in keyset]))
+
+    def test_search_index(self):
+        keys = self.keygen(self.nentries)
+        self.session.create(self.uri, 'key_format=u,value_format=u')
+        cursor = self.session.open_cursor(self.uri)
+        for key in keys:
+            cursor[key] = self.value(key)
+        cursor.close()
+
+        # Write the tree and read it back so the leaf pages are instantiated from disk.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri)
+
+        # Every key is found, with its value.
+        for key in keys:
+            cursor.set_key(key)
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), self.value(key))
+
+        # Absent keys aren't found, and search-near lands on a neighbor.
+        for key in self.absent_keys(keys):
+            cursor.set_key(key)
+            self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+
+            cursor.set_key(key)
+            exact = cursor.search_near()
+            found = cursor.get_key()
+            i = bisect.bisect_left(keys, key)
+            if exact < 0:
+                self.assertEqual(found, keys[i - 1])
+            else:
+                self.assertGreater(exact, 0)
+                self.assertEqual(found, keys[i])
+
+        # Search-near on present keys is exact.
+        for key in keys[::13]:
+            cursor.set_key(key)
+            self.assertEqual(cursor.search_near(), 0)
+            self.assertEqual(cursor.get_key(), key)
+        cursor.close()
+
+        # Inserts on the instantiated pages go into their insert lists, searches find them too.
+        cursor = self.session.open_cursor(self.uri)
+        added = self.absent_keys(keys)
+        for key in added:
+            cursor[key] = self.value(key)
+        for key in keys + added:
+            cursor.set_key(key)
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), self.value(key))
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import threading
+import wttest
+from wiredtiger import stat
+
+# test_stat12.py
+#    Statistics slots are chosen by CPU and threads move between CPUs: check the totals summed over
+#    the slots are exact when many threads update the same statistics at once.
+class test_stat12(wttest.WiredTigerTestCase):
+    uri = 'table:test_stat12'
+    conn_config = 'statistics=(all)'
+    nthreads = 8
+    nops = 5000
+
+    def get_stat(self, uri, stat):
+        statc = self.session.open_cursor('statistics:' + uri, None, None)
+        val = statc[stat][2]
+        statc.close()
+        return val
+
+    def worker(self, id):
+        session = self.conn.open_session()
+        cursor = session.open_cursor(self.uri)
+        for i in range(self.nops):
+            key = id * self.nops + i
+            cursor[key] = str(key)
+            cursor.set_key(key)
+            self.assertEqual(cursor.search(), 0)
+        cursor.close()
+        session.close()
+
+    def test_stat_slots(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+
+        inserts = self.get_stat('', stat.conn.cursor_insert)
+        searches = self.get_stat('', stat.conn.cursor_search)
+
+        threads = [threading.Thread(target=self.worker, args=(i,)) for i in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        total = self.nthreads * self.nops
+        self.assertEqual(self.get_stat('', stat.conn.cursor_insert) - inserts, total)
+        self.assertEqual(self.get_stat('', stat.conn.cursor_search) - searches, total)
+        self.assertEqual(self.get_stat(self.uri, stat.dsrc.cursor_insert), total)
+        self.assertEqual(self.get_stat(self.uri, stat.dsrc.cursor_search), total)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import simulate_crash_restart
+from wtscenario import make_scenarios
+
+# test_txn29.py
+#   Recovery applying the log with worker threads: operations on each file are applied in log
+#   order, whichever thread applies them, including truncates and multi-table transactions.
+class test_txn29(wttest.WiredTigerTestCase):
+    ntables = 5
+    nops = 20000
+
+    threads = [
+        ('serial', dict(recover_threads=0)),
+        ('one', dict(recover_threads=1)),
+        ('four', dict(recover_threads=4)),
+    ]
+    scenarios = make_scenarios(threads)
+
+    def conn_config(self):
+        return 'log=(enabled,file_max=1MB,recover_threads={}),'.format(self.recover_threads) + \
+            'transaction_sync=(enabled,method=none)'
+
+    def test_recover_threads(self):
+        uris = ['table:test_txn29_{}'.format(i) for i in range(self.ntables)]
+        for uri in uris:
+            self.session.create(uri, 'key_format=S,value_format=S')
+        col_uri = 'table:test_txn29_col'
+        self.session.create(col_uri, 'key_format=r,value_format=S')
+        self.session.checkpoint()
+
+        cursors = [self.session.open_cursor(uri) for uri in uris]
+        col_cursor = self.session.open_cursor(col_uri)
+        expected = [dict() for uri in uris]
+        col_expected = dict()
+
+        for i in range(self.nops):
+            t = i % self.ntables
+            key = '{:06d}'.format(i // self.ntables % 1000)
+            value = 'value-{}-{}'.format(t, i)
+            if i % 5 == 0:
+                # A transaction updating several files.
+                u = (t + 1) % self.ntables
+                self.session.begin_transaction()
+                cursors[t][key] = value
+                cursors[u][key] = value
+                col_cursor[i % 700 + 1] = value
+                self.session.commit_transaction()
+                expected[t][key] = expected[u][key] = col_expected[i % 700 + 1] = value
+            elif i % 7 == 0 and key in expected[t]:
+                cursors[t].set_key(key)
+                self.assertEqual(cursors[t].remove(), 0)
+                del expected[t][key]
+            elif i % 11 == 0 and key in expected[t]:
+                # Modify operations read the value written by earlier operations on the file.
+                self.session.begin_transaction()
+                cursors[t].set_key(key)
+                mods = [wiredtiger.Modify('XY', 3, 1)]
+                self.assertEqual(cursors[t].modify(mods), 0)
+                self.session.commit_transaction()
+                old = expected[t][key]
+                expected[t][key] = old[:3] + 'XY' + old[4:]
+            else:
+                cursors[t][key] = value
+                expected[t][key] = value
+
+            if i == self.nops // 2:
+                # Truncate a range of one table and the whole of another.
+                start = self.session.open_cursor(uris[2])
+                stop = self.session.open_cursor(uris[2])
+                start.set_key('000100')
+                stop.set_key('000500')
+                self.session.truncate(None, start, stop, None)
+                start.close()
+                stop.close()
+                for key in list(expected[2]):
+                    if '000100' <= key <= '000500':
+                        del expected[2][key]
+                self.session.truncate(uris[3], None, None, None)
+                expected[3].clear()
+
+        for c in cursors:
+            c.close()
+        col_cursor.close()
+        simulate_crash_restart(self, '.', 'RESTART')
+
+        for uri, model in zip(uris, expected):
+            self.assertEqual(dict(self.session.open_cursor(uri)), model)
+        self.assertEqual(dict(self.session.open_cursor(col_uri)), col_expected)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wttest
+from wiredtiger import stat
+
+# test_txn30.py
+#   Snapshots taken without a transaction ID reuse the last walk of the concurrent sessions while
+#   no ID is allocated or released, and stop reusing it as soon as one is.
+class test_txn30(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    uri = 'table:test_txn30'
+
+    def get_stat(self, stat_name):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat_name][2]
+        stat_cursor.close()
+        return val
+
+    def read(self, session, key):
+        session.begin_transaction()
+        cursor = session.open_cursor(self.uri)
+        cursor.set_key(key)
+        value = cursor.get_value() if cursor.search() == 0 else None
+        cursor.close()
+        session.rollback_transaction()
+        return value
+
+    def test_snapshot_cache(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(10):
+            cursor[i] = 'old'
+
+        # Leave a transaction with an ID running so snapshots have to look at the other sessions.
+        writer = self.conn.open_session()
+        writer_cursor = writer.open_cursor(self.uri)
+        writer.begin_transaction()
+        writer_cursor[1] = 'new'
+
+        # Another running transaction keeps the oldest ID behind the current ID.
+        pinner = self.conn.open_session()
+        pinner.begin_transaction()
+        pinner_cursor = pinner.open_cursor(self.uri)
+        pinner_cursor[2] = 'pinned'
+
+        readers = [self.conn.open_session() for i in range(4)]
+        hits = self.get_stat(stat.conn.txn_snapshot_cache_hit)
+        for i in range(20):
+            for reader in readers:
+                self.assertEqual(self.read(reader, 1), 'old')
+        self.assertGreater(self.get_stat(stat.conn.txn_snapshot_cache_hit), hits)
+
+        # A transaction allocating an ID and committing must be seen by the next snapshot.
+        cursor[3] = 'committed'
+        for reader in readers:
+            self.assertEqual(self.read(reader, 3), 'committed')
+
+        # Releasing the writer's ID must be seen as well.
+        writer.commit_transaction()
+        for reader in readers:
+            self.assertEqual(self.read(reader, 1), 'new')
+            self.assertEqual(self.read(reader, 2), 'old')
+
+        pinner.rollback_transaction()
+        for reader in readers:
+            self.assertEqual(self.read(reader, 2), 'old')